@@ -22,16 +22,28 @@ function autobuild()
     platformio lib --global install https://github.com/Erriez/ErriezTM1638
 
     echo "Building examples..."
+    platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/Animation/Animation.ino
+    platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/Benchmark/Benchmark.ino
     platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/Brightness/Brightness.ino
     platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/Buttons/Buttons.ino
+    platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/Chain/Chain.ino
     platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/Counter/Counter.ino
     platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/Date/Date.ino
     platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/Demo/Demo.ino
+    platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/Marquee/Marquee.ino
+    platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/Meter/Meter.ino
+    platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/Tally/Tally.ino
     platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/Temperature/Temperature.ino
     platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/TestLEDs/TestLEDs.ino
     platformio ci --lib="." ${BOARDS_AVR} ${BOARDS_ESP} examples/Time/Time.ino
 }
 
+function host_tests()
+{
+    echo "Running host tests..."
+    make -C extras/host check
+}
+
 function generate_doxygen()
 {
     echo "Generate Doxygen HTML..."
@@ -58,5 +70,6 @@ function generate_doxygen()
 }
 
 autobuild
+host_tests
 generate_doxygen
 
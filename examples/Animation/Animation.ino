@@ -0,0 +1,130 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* JY-LKM1638 board v1.1 animation example
+ *
+ * Plays animations from flash without delay(). Only registers which change
+ * between two frames are written.
+ *
+ * Required libraries:
+ *   https://github.com/Erriez/ErriezTM1638
+ *   https://github.com/Erriez/ErriezLKM1638
+ */
+
+#include <ErriezLKM1638Board.h>
+#include <ErriezLKM1638Animation.h>
+
+// Connect display pins to the Arduino DIGITAL pins
+#if ARDUINO_ARCH_AVR
+#define TM1638_CLK_PIN      2
+#define TM1638_DIO_PIN      3
+#define TM1638_STB0_PIN     4
+#elif ARDUINO_ARCH_ESP8266
+#define TM1638_CLK_PIN      D2
+#define TM1638_DIO_PIN      D3
+#define TM1638_STB0_PIN     D4
+#elif ARDUINO_ARCH_ESP32
+#define TM1638_CLK_PIN      0
+#define TM1638_DIO_PIN      4
+#define TM1638_STB0_PIN     5
+#else
+#error "May work, but not tested on this target"
+#endif
+
+// Create LKM1638Board object
+LKM1638Board lkm1638(TM1638_CLK_PIN, TM1638_DIO_PIN, TM1638_STB0_PIN);
+
+// Create animation players
+LKM1638Animation attention(lkm1638);
+LKM1638Animation spinner(lkm1638);
+LKM1638Animation chase(lkm1638);
+
+// Attention: 16 Byte register images, digit 7 at address 0x00, LED 7 at 0x01
+static const PROGMEM uint8_t ATTENTION_FRAMES[] = {
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+    0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x01,
+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Spinner in digit 0 (address 0x0E): count, address, data
+static const PROGMEM uint8_t SPINNER_DELTAS[] = {
+    1, 0x0E, 0b00000001,
+    1, 0x0E, 0b00000010,
+    1, 0x0E, 0b00000100,
+    1, 0x0E, 0b00001000,
+    1, 0x0E, 0b00010000,
+    1, 0x0E, 0b00100000,
+};
+
+// Red LED from right to left: turn previous LED off, next LED red
+static const PROGMEM uint8_t CHASE_DELTAS[] = {
+    2, 0x01, LedOff, 0x0F, LedRed,
+    2, 0x0F, LedOff, 0x0D, LedRed,
+    2, 0x0D, LedOff, 0x0B, LedRed,
+    2, 0x0B, LedOff, 0x09, LedRed,
+    2, 0x09, LedOff, 0x07, LedRed,
+    2, 0x07, LedOff, 0x05, LedRed,
+    2, 0x05, LedOff, 0x03, LedRed,
+    2, 0x03, LedOff, 0x01, LedRed,
+};
+
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial) {
+        ;
+    }
+    Serial.println(F("JY-LKM1638 animation example"));
+
+    // Initialize TM1638
+    lkm1638.begin();
+    lkm1638.clear();
+    lkm1638.setBrightness(2);
+
+    // Flash all digits and LED's every 250ms
+    attention.setInterval(250);
+    attention.playFrames(ATTENTION_FRAMES, 2);
+}
+
+void loop()
+{
+    // Start spinner and LED chase after 3 seconds
+    if (attention.isRunning() && (millis() > 3000)) {
+        attention.stop();
+        lkm1638.clear();
+
+        spinner.playDeltas(SPINNER_DELTAS, 6);
+
+        chase.setInterval(150);
+        chase.playDeltas(CHASE_DELTAS, 8);
+    }
+
+    // Display next frames without blocking
+    attention.poll();
+    spinner.poll();
+    chase.poll();
+}
@@ -0,0 +1,225 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* JY-LKM1638 board v1.1 benchmark example
+ *
+ * Measures the duration of every public display, LED and button function and
+ * prints the results as CSV on the serial port, so results can be compared
+ * between library versions.
+ *
+ * The formatDigits() rows measure the digit conversion of the print functions
+ * without the bus, as a baseline for formatter changes.
+ *
+ * Build with -DLKM1638_STATS=1 to print the bus transactions, Bytes, STB
+ * frames, clock edges, redundant register writes and the estimated bus time at
+ * BIT_PERIOD_NS per call as well. extras/host/benchmark.cpp reports the same
+ * bus cost on a simulated TM1638 without hardware.
+ *
+ * Required libraries:
+ *   https://github.com/Erriez/ErriezTM1638
+ *   https://github.com/Erriez/ErriezLKM1638
+ */
+
+#include <ErriezLKM1638Board.h>
+
+// Connect display pins to the Arduino DIGITAL pins
+#if ARDUINO_ARCH_AVR
+#define TM1638_CLK_PIN      2
+#define TM1638_DIO_PIN      3
+#define TM1638_STB0_PIN     4
+#elif ARDUINO_ARCH_ESP8266
+#define TM1638_CLK_PIN      D2
+#define TM1638_DIO_PIN      D3
+#define TM1638_STB0_PIN     D4
+#elif ARDUINO_ARCH_ESP32
+#define TM1638_CLK_PIN      0
+#define TM1638_DIO_PIN      4
+#define TM1638_STB0_PIN     5
+#else
+#error "May work, but not tested on this target"
+#endif
+
+// Number of calls per measurement
+#define ITERATIONS          100
+
+// Bit period for the estimated bus time in ns, override with a build flag
+#ifndef BIT_PERIOD_NS
+#define BIT_PERIOD_NS       1000
+#endif
+
+// Measure average duration of a statement
+#define BENCHMARK(name, statement)                      \
+    do {                                                \
+        unsigned long startUs;                          \
+        lkm1638.resetStats();                           \
+        startUs = micros();                             \
+        for (uint16_t i = 0; i < ITERATIONS; i++) {     \
+            statement;                                  \
+        }                                               \
+        printResult(F(name), micros() - startUs);       \
+    } while (0)
+
+// Create LKM1638Board object
+LKM1638Board lkm1638(TM1638_CLK_PIN, TM1638_DIO_PIN, TM1638_STB0_PIN);
+
+// Function prototypes
+static void runBenchmarks();
+static void printResult(const __FlashStringHelper *name, unsigned long durationUs);
+
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial) {
+        ;
+    }
+    Serial.println(F("JY-LKM1638 benchmark example"));
+
+    // Initialize TM1638
+    lkm1638.begin();
+    lkm1638.clear();
+
+    runBenchmarks();
+}
+
+void loop()
+{
+
+}
+
+static void runBenchmarks()
+{
+    uint8_t u8 = 123;
+    uint16_t u16 = 12345;
+    unsigned long u32 = 12345678UL;
+    int8_t s8 = -123;
+    int16_t s16 = -12345;
+    long s32 = -1234567L;
+    volatile uint8_t buttons;
+    uint8_t digits[NUM_DIGITS];
+
+#if LKM1638_STATS
+    Serial.println(F("name,us_per_call,writes_per_call,bytes_per_call,frames_per_call,"
+                     "clk_edges_per_call,bus_us_per_call,redundant_per_call"));
+#else
+    Serial.println(F("name,us_per_call"));
+#endif
+
+    // Unsigned print
+    BENCHMARK("print(uint8_t)", lkm1638.print(u8));
+    BENCHMARK("print(uint8_t,HEX)", lkm1638.print(u8, HEX));
+    BENCHMARK("print(uint8_t,DEC,3)", lkm1638.print(u8, DEC, 3));
+    BENCHMARK("print(uint8_t,DEC,3,3)", lkm1638.print(u8, DEC, 3, 3));
+    BENCHMARK("print(uint16_t)", lkm1638.print(u16));
+    BENCHMARK("print(uint16_t,HEX)", lkm1638.print(u16, HEX));
+    BENCHMARK("print(uint16_t,DEC,5)", lkm1638.print(u16, DEC, 5));
+    BENCHMARK("print(uint16_t,DEC,5,5)", lkm1638.print(u16, DEC, 5, 5));
+    BENCHMARK("print(unsigned long)", lkm1638.print(u32));
+    BENCHMARK("print(unsigned long,HEX)", lkm1638.print(u32, HEX));
+    BENCHMARK("print(unsigned long,DEC,8)", lkm1638.print(u32, DEC, 8));
+    BENCHMARK("print(unsigned long,DEC,8,8)", lkm1638.print(u32, DEC, 8, 8));
+
+    // Signed print
+    BENCHMARK("print(int8_t)", lkm1638.print(s8));
+    BENCHMARK("print(int8_t,HEX)", lkm1638.print(s8, HEX));
+    BENCHMARK("print(int8_t,DEC,4)", lkm1638.print(s8, DEC, 4));
+    BENCHMARK("print(int16_t)", lkm1638.print(s16));
+    BENCHMARK("print(int16_t,HEX)", lkm1638.print(s16, HEX));
+    BENCHMARK("print(int16_t,DEC,6)", lkm1638.print(s16, DEC, 6));
+    BENCHMARK("print(long)", lkm1638.print(s32));
+    BENCHMARK("print(long,HEX)", lkm1638.print(s32, HEX));
+    BENCHMARK("print(long,DEC,8)", lkm1638.print(s32, DEC, 8));
+
+    // Binary print
+    BENCHMARK("print(uint8_t,BIN,8,8)", lkm1638.print(u8, BIN, 8, 8));
+
+    // Digit conversion only, new value on every call
+    BENCHMARK("formatDigits(DEC)",
+              LKM1638Board::formatDigits(u32 + i, DEC, digits, NUM_DIGITS));
+    BENCHMARK("formatDigits(HEX)",
+              LKM1638Board::formatDigits(u32 + i, HEX, digits, NUM_DIGITS));
+    BENCHMARK("formatDigits(BIN)",
+              LKM1638Board::formatDigits(u8 + i, BIN, digits, NUM_DIGITS));
+
+    // Segments, dots and refresh
+    BENCHMARK("setSegmentsDigit()", lkm1638.setSegmentsDigit(0, SEGMENTS_MINUS));
+    BENCHMARK("setDigit()", lkm1638.setDigit(0, 8));
+    BENCHMARK("dotOn()", lkm1638.dotOn(0));
+    BENCHMARK("dotOff()", lkm1638.dotOff(0));
+    BENCHMARK("setDots()", lkm1638.setDots(0x55));
+    BENCHMARK("refresh()", lkm1638.refresh());
+
+    // Dual color LED's
+    BENCHMARK("setColorLED()", lkm1638.setColorLED(0, LedRed));
+    BENCHMARK("colorLEDsOn(0xFF)", lkm1638.colorLEDsOn(0xFF, LedGreen));
+    BENCHMARK("colorLEDsOff(0xFF)", lkm1638.colorLEDsOff(0xFF));
+    BENCHMARK("colorLEDsOff(0xFF)+colorLEDsOn() update",
+              lkm1638.beginUpdate(); lkm1638.colorLEDsOff(0xFF);
+              lkm1638.colorLEDsOn(0x01, LedRed); lkm1638.endUpdate());
+
+    // Clear and buttons
+    BENCHMARK("clear()", lkm1638.clear());
+    BENCHMARK("getButtons()", buttons = lkm1638.getButtons());
+    (void)buttons;
+
+    // Buffered mode: new value on every call, written with one flush
+    lkm1638.setBuffered(true);
+    BENCHMARK("buffered print(unsigned long)+flush()",
+              lkm1638.print(u32 + i); lkm1638.flush());
+    BENCHMARK("buffered setDots()+flush()",
+              lkm1638.setDots((uint8_t)i); lkm1638.flush());
+    BENCHMARK("buffered colorLEDsOn(0xFF)+flush()",
+              lkm1638.colorLEDsOn(0xFF, (i & 1) ? LedRed : LedGreen); lkm1638.flush());
+    lkm1638.setBuffered(false);
+
+    Serial.println(F("Done"));
+}
+
+static void printResult(const __FlashStringHelper *name, unsigned long durationUs)
+{
+    Serial.print(name);
+    Serial.print(F(","));
+#if LKM1638_STATS
+    LKM1638Stats stats;
+
+    lkm1638.getStats(&stats);
+    Serial.print(durationUs / ITERATIONS);
+    Serial.print(F(","));
+    Serial.print((float)stats.writes / ITERATIONS);
+    Serial.print(F(","));
+    Serial.print((float)stats.bytes / ITERATIONS);
+    Serial.print(F(","));
+    Serial.print((float)stats.frames / ITERATIONS);
+    Serial.print(F(","));
+    // 8 clock cycles of 2 edges per Byte
+    Serial.print((float)stats.bytes * 16 / ITERATIONS);
+    Serial.print(F(","));
+    // One bit period per clock cycle and per STB frame
+    Serial.print(((float)stats.bytes * 8 + stats.frames) * BIT_PERIOD_NS / 1000 / ITERATIONS);
+    Serial.print(F(","));
+    Serial.println((float)stats.redundantWrites / ITERATIONS);
+#else
+    Serial.println(durationUs / ITERATIONS);
+#endif
+}
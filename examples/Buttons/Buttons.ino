@@ -30,6 +30,7 @@
  */
 
 #include <ErriezLKM1638Board.h>
+#include <ErriezLKM1638Buttons.h>
 
 // Connect display pins to the Arduino DIGITAL pins
 #if ARDUINO_ARCH_AVR
@@ -51,9 +52,11 @@
 // Create LKM1638Board object
 LKM1638Board lkm1638(TM1638_CLK_PIN, TM1638_DIO_PIN, TM1638_STB0_PIN);
 
-// Static variables
-static uint8_t keys = 0;
-static uint8_t lastKeys = 0;
+// Create debounced buttons object
+LKM1638Buttons buttons(lkm1638);
+
+// Function prototype
+static void printEvent(ButtonEvent *event);
 
 
 void setup()
@@ -72,35 +75,47 @@ void setup()
 
 void loop()
 {
-    // Get buttons
-    keys = lkm1638.getButtons();
-
-    // Check if button changed
-    if (lastKeys != keys) {
-        lastKeys = keys;
-
-        // Display dual color LED
-        for (uint8_t i = 0; i < 8; i++) {
-            if (keys & (1 << i)) {
-                // Button down
-
-                // Upper 4 LED's red, lower 4 LED's green
-                if (i >= 4) {
-                    lkm1638.setColorLED(i, LedRed);
-                } else {
-                    lkm1638.setColorLED(i, LedGreen);
-                }
-            } else {
-                // Turn LED off when button is up
-                lkm1638.setColorLED(i, LedOff);
-            }
-        }
-
-        // Print button serial
-        Serial.print(F("0x"));
-        if (keys < 0x10) {
-            Serial.print(0);
-        }
-        Serial.println(keys, HEX);
+    ButtonEvent event;
+
+    // Scan buttons when the scan interval elapsed
+    buttons.poll();
+
+    // Handle button events
+    while (buttons.read(&event)) {
+        uint8_t keys = buttons.getButtons();
+
+        // Display dual color LED's of buttons down: upper 4 LED's red, lower
+        // 4 LED's green. LED's of buttons up are turned off.
+        lkm1638.setColorLEDs(keys & 0xF0, keys & 0x0F);
+
+        printEvent(&event);
+    }
+}
+
+static void printEvent(ButtonEvent *event)
+{
+    switch (event->type) {
+        case ButtonPress:
+            Serial.print(F("Press:      "));
+            break;
+        case ButtonRelease:
+            Serial.print(F("Release:    "));
+            break;
+        case ButtonLongPress:
+            Serial.print(F("Long press: "));
+            break;
+        case ButtonRepeat:
+            Serial.print(F("Repeat:     "));
+            break;
+        case ButtonChord:
+            Serial.print(F("Chord:      "));
+            break;
+    }
+
+    // Print buttons
+    Serial.print(F("0x"));
+    if (event->buttons < 0x10) {
+        Serial.print(0);
     }
+    Serial.println(event->buttons, HEX);
 }
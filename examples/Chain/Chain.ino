@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* JY-LKM1638 board v1.1 chain example
+ *
+ * Two LKM1638 boards sharing the CLK and DIO pins as one 16 digit display.
+ *
+ * Required libraries:
+ *   https://github.com/Erriez/ErriezTM1638
+ *   https://github.com/Erriez/ErriezLKM1638
+ */
+
+#include <ErriezLKM1638Chain.h>
+
+// Connect display pins to the Arduino DIGITAL pins
+#if ARDUINO_ARCH_AVR
+#define TM1638_CLK_PIN      2
+#define TM1638_DIO_PIN      3
+#define TM1638_STB0_PIN     4
+#define TM1638_STB1_PIN     5
+#elif ARDUINO_ARCH_ESP8266
+#define TM1638_CLK_PIN      D2
+#define TM1638_DIO_PIN      D3
+#define TM1638_STB0_PIN     D4
+#define TM1638_STB1_PIN     D5
+#elif ARDUINO_ARCH_ESP32
+#define TM1638_CLK_PIN      0
+#define TM1638_DIO_PIN      4
+#define TM1638_STB0_PIN     5
+#define TM1638_STB1_PIN     18
+#else
+#error "May work, but not tested on this target"
+#endif
+
+// Create LKM1638Board objects, most right board first
+LKM1638Board boards[] = {
+    LKM1638Board(TM1638_CLK_PIN, TM1638_DIO_PIN, TM1638_STB0_PIN),
+    LKM1638Board(TM1638_CLK_PIN, TM1638_DIO_PIN, TM1638_STB1_PIN)
+};
+
+// Create chain of 2 boards
+LKM1638Chain chain(boards, sizeof(boards) / sizeof(boards[0]));
+
+// Initialize static count variable with a value
+static unsigned long count = 1234567890UL;
+
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial) {
+        ;
+    }
+    Serial.println(F("JY-LKM1638 chain example"));
+
+    // Initialize all boards
+    chain.begin();
+    chain.clear();
+    chain.setBrightness(2);
+}
+
+void loop()
+{
+    uint8_t buttons[2];
+
+    // Display count on all boards
+    chain.setPrintPos(0);
+    chain.print(count++);
+
+    // Display buttons of both boards on the dual color LED's
+    chain.getButtons(buttons);
+    chain.getBoard(0)->setColorLEDs(buttons[0], 0);
+    chain.getBoard(1)->setColorLEDs(0, buttons[1]);
+
+    // Write changed digits and LED's of all boards
+    chain.flush();
+
+    delay(100);
+}
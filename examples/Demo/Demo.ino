@@ -30,6 +30,7 @@
  */
 
 #include <ErriezLKM1638Board.h>
+#include <ErriezLKM1638Buttons.h>
 
 // Connect display pins to the Arduino DIGITAL pins
 #if ARDUINO_ARCH_AVR
@@ -51,6 +52,9 @@
 // Create LKM1638Board object
 LKM1638Board lkm1638(TM1638_CLK_PIN, TM1638_DIO_PIN, TM1638_STB0_PIN);
 
+// Create debounced buttons object
+LKM1638Buttons buttons(lkm1638);
+
 static uint8_t led = 0;
 static uint8_t dir = 1;
 static LedColor color = LedRed;
@@ -104,58 +108,56 @@ void loop()
 
 static void handleButtons(void)
 {
-    static uint8_t keysMask = 0;
+    ButtonEvent event;
     uint8_t keys;
 
-    // Get keys
-    keys = lkm1638.getButtons();
+    // Scan buttons when the scan interval elapsed
+    buttons.poll();
 
-    // Mask keys to execute increment or decrement state only when the switch is
-    // down the first time
-    if (keys == 0) {
-        keysMask = 0;
-    } else {
-        if (keysMask == 0) {
-            if (keys & 0x01) {
-                // Change color
-                if (color == LedGreen) {
-                    color = LedRed;
-                } else {
-                    color = LedGreen;
-                }
-            } else if (keys & 0x02) {
-                // Change direction
-                dir ^= 1;
-            } else if (keys & 0x04) {
-                // Speed down
-                if (ledDelayInit < 20) {
-                    ledDelayInit += 2;
-                }
-            } else if (keys & 0x08) {
-                // Speed up
-                if (ledDelayInit > 2) {
-                    ledDelayInit -= 2;
-                }
-            } else if (keys & 0x10) {
-                // Change display brightness
-                if (brightness == 7) {
-                    brightness = 0;
-                } else {
-                    brightness++;
-                }
-                lkm1638.setBrightness(brightness);
-            } else if (keys & 0x20) {
-                // Toggle count up/down
-                countUp ^= true;
-            } else if (keys & 0x40) {
-                // Clear count
-                countValue = 0;
-            } else if (keys & 0x80) {
-                // Toggle count enable
-                countEnable ^= true;
-            }
+    // Execute increment or decrement state only when the switch is pressed
+    while (buttons.read(&event)) {
+        if (event.type != ButtonPress) {
+            continue;
+        }
+        keys = event.buttons;
 
-            keysMask = keys;
+        if (keys & 0x01) {
+            // Change color
+            if (color == LedGreen) {
+                color = LedRed;
+            } else {
+                color = LedGreen;
+            }
+        } else if (keys & 0x02) {
+            // Change direction
+            dir ^= 1;
+        } else if (keys & 0x04) {
+            // Speed down
+            if (ledDelayInit < 20) {
+                ledDelayInit += 2;
+            }
+        } else if (keys & 0x08) {
+            // Speed up
+            if (ledDelayInit > 2) {
+                ledDelayInit -= 2;
+            }
+        } else if (keys & 0x10) {
+            // Change display brightness
+            if (brightness == 7) {
+                brightness = 0;
+            } else {
+                brightness++;
+            }
+            lkm1638.setBrightness(brightness);
+        } else if (keys & 0x20) {
+            // Toggle count up/down
+            countUp ^= true;
+        } else if (keys & 0x40) {
+            // Clear count
+            countValue = 0;
+        } else if (keys & 0x80) {
+            // Toggle count enable
+            countEnable ^= true;
         }
     }
 }
@@ -165,8 +167,11 @@ static void handleLEDs(void)
     if (ledDelay <= 4) {
         ledDelay = ledDelayInit;
 
+        // Write only the LED's which changed
+        lkm1638.beginUpdate();
         lkm1638.colorLEDsOff(0xff);
         lkm1638.colorLEDsOn((uint8_t)(1 << led), color);
+        lkm1638.endUpdate();
 
         if (dir) {
             if (led >= 7) {
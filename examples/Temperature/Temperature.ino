@@ -72,34 +72,26 @@ void setup()
 void loop()
 {
     int temperature;
-    int8_t value;
-    uint8_t remainder;
+    unsigned int absTemperature;
 
-    // Get random temperature
+    // Get random temperature in 0.1 degree Celsius
     temperature = getTemperature();
 
-    // Calculate signed temperature
-    value = temperature / 10;
-
-    // Calculate unsigned remainder temperature (1 digit)
-    if (temperature < 0) {
-        remainder = (uint8_t)(temperature * -1) % 10;
-    } else {
-        remainder = (uint8_t)temperature % 10;
-    }
-
-    lkm1638.setPrintPos(3);
-    lkm1638.print(value, DEC);
+    // Display temperature with one decimal on digits 7..2
     lkm1638.setPrintPos(2);
-    lkm1638.print(remainder, DEC, 1);
-    lkm1638.dotOn(3);
+    lkm1638.printFixed(temperature, 1, 6);
     lkm1638.setSegmentsDigit(1, SEGMENTS_DEGREE);
     lkm1638.setSegmentsDigit(0, SEGMENTS_C);
 
-    // Print temperature on serial console
-    Serial.print(value);
+    // Print temperature on serial console with integer parts, the minus sign
+    // is printed separately for -0.1 .. -0.9
+    absTemperature = (temperature < 0) ? (unsigned int)-temperature : (unsigned int)temperature;
+    if (temperature < 0) {
+        Serial.print(F("-"));
+    }
+    Serial.print(absTemperature / 10);
     Serial.print(F("."));
-    Serial.print(remainder);
+    Serial.print(absTemperature % 10);
     Serial.println(F("`C"));
 
     delay(2000);
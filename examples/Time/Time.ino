@@ -30,6 +30,7 @@
  */
 
 #include <ErriezLKM1638Board.h>
+#include <ErriezLKM1638Layout.h>
 
 // Connect display pins to the Arduino DIGITAL pins
 #if ARDUINO_ARCH_AVR
@@ -51,6 +52,16 @@
 // Create LKM1638Board object
 LKM1638Board lkm1638(TM1638_CLK_PIN, TM1638_DIO_PIN, TM1638_STB0_PIN);
 
+// Time fields hh.mm.ss: pos, numDigits, radius, pad, fracDigits, flags
+static const LKM1638Field timeFields[] = {
+    { 4, 2, DEC, 1, 0, FIELD_DOT },     // Hours
+    { 2, 2, DEC, 2, 0, FIELD_DOT },     // Minutes
+    { 0, 2, DEC, 2, 0, 0 },             // Seconds
+};
+
+// Create layout with time fields
+LKM1638Layout timeLayout(lkm1638, timeFields, 3);
+
 typedef struct {
     uint8_t hours;
     uint8_t minutes;
@@ -77,6 +88,9 @@ void setup()
     lkm1638.begin();
     lkm1638.clear();
     lkm1638.setBrightness(2);
+
+    // Validate time fields
+    timeLayout.begin();
 }
 
 void loop()
@@ -89,18 +103,15 @@ void loop()
 
 static void displayTime()
 {
-    lkm1638.setPrintPos(4);
-    lkm1638.print(tm.hours, DEC, 2);
-    lkm1638.setPrintPos(2);
-    lkm1638.print(tm.minutes, DEC, 2, 2);
-    lkm1638.setPrintPos(0);
-    lkm1638.print(tm.seconds, DEC, 2, 2);
-    lkm1638.dotOn(2);
-    if (tm.seconds & 1) {
-        lkm1638.dotOn(4);
-    } else {
-        lkm1638.dotOff(4);
-    }
+    timeLayout.set(0, tm.hours);
+    timeLayout.set(1, tm.minutes);
+    timeLayout.set(2, tm.seconds);
+
+    // Blink dot between hours and minutes
+    timeLayout.setDot(0, tm.seconds & 1);
+
+    // Write all changed digits at once
+    timeLayout.update();
 }
 
 static void incrementTime()
@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file Arduino.cpp
+ * \brief Minimal Arduino API for host builds of the LKM1638 library
+ */
+
+#include <stdio.h>
+
+#include "Arduino.h"
+#include "TM1638Sim.h"
+
+HostSerial Serial;
+
+static uint8_t pinLevels[256];  // Levels written by digitalWrite()
+static unsigned long long hostUs;  // Simulated time
+
+//------------------------------------------------------------------------------
+// Digital pins
+//------------------------------------------------------------------------------
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    if (mode == INPUT_PULLUP) {
+        pinLevels[pin] = HIGH;
+    }
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    pinLevels[pin] = (value == LOW) ? LOW : HIGH;
+    TM1638Sim::pinChanged(pin, pinLevels[pin]);
+}
+
+int digitalRead(uint8_t pin)
+{
+    uint8_t level;
+
+    if (TM1638Sim::pinDriven(pin, &level)) {
+        return level;
+    }
+
+    return pinLevels[pin];
+}
+
+//------------------------------------------------------------------------------
+// Simulated time
+//------------------------------------------------------------------------------
+unsigned long millis()
+{
+    return (unsigned long)(hostUs / 1000);
+}
+
+unsigned long micros()
+{
+    return (unsigned long)hostUs;
+}
+
+void delay(unsigned long ms)
+{
+    hostUs += (unsigned long long)ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    hostUs += us;
+}
+
+/*!
+ * \brief Advance simulated time without a delay in the library
+ * \param us Microseconds
+ */
+void hostAdvanceMicros(unsigned long us)
+{
+    hostUs += us;
+}
+
+//------------------------------------------------------------------------------
+// Interrupts
+//------------------------------------------------------------------------------
+void noInterrupts()
+{
+}
+
+void interrupts()
+{
+}
+
+//------------------------------------------------------------------------------
+// Serial port
+//------------------------------------------------------------------------------
+void HostSerial::print(const char *text)
+{
+    fputs(text, stdout);
+}
+
+void HostSerial::print(const __FlashStringHelper *text)
+{
+    fputs(reinterpret_cast<const char *>(text), stdout);
+}
+
+void HostSerial::print(char c)
+{
+    putchar(c);
+}
+
+void HostSerial::print(long value, int radius)
+{
+    if (value < 0) {
+        putchar('-');
+        print((unsigned long)0 - (unsigned long)value, radius);
+    } else {
+        print((unsigned long)value, radius);
+    }
+}
+
+void HostSerial::print(unsigned long value, int radius)
+{
+    char buf[8 * sizeof(long) + 1];
+    char *p = &buf[sizeof(buf) - 1];
+
+    if ((radius < 2) || (radius > 16)) {
+        radius = DEC;
+    }
+
+    *p = '\0';
+    do {
+        *--p = "0123456789ABCDEF"[value % (unsigned long)radius];
+        value /= (unsigned long)radius;
+    } while (value);
+
+    fputs(p, stdout);
+}
+
+void HostSerial::print(double value, int fracDigits)
+{
+    printf("%.*f", fracDigits, value);
+}
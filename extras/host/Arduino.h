@@ -0,0 +1,106 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file Arduino.h
+ * \brief Minimal Arduino API for host builds of the LKM1638 library
+ * \details
+ *      Pin functions drive the simulated TM1638 boards of TM1638Sim.h. Time
+ *      is simulated: millis() and micros() only advance by delay(),
+ *      delayMicroseconds() and hostAdvanceMicros().
+ */
+
+#ifndef ERRIEZ_LKM1638_HOST_ARDUINO_H_
+#define ERRIEZ_LKM1638_HOST_ARDUINO_H_
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HIGH            1
+#define LOW             0
+
+#define INPUT           0
+#define OUTPUT          1
+#define INPUT_PULLUP    2
+
+#define DEC             10
+#define HEX             16
+#define OCT             8
+#define BIN             2
+
+#define PROGMEM
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+class __FlashStringHelper;
+#define F(s)            (reinterpret_cast<const __FlashStringHelper *>(s))
+
+// Digital pins
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+// Simulated time
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void hostAdvanceMicros(unsigned long us);
+
+// Interrupts
+void noInterrupts();
+void interrupts();
+
+/*!
+ * \brief Serial port, written to stdout
+ */
+class HostSerial
+{
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    operator bool() const { return true; }
+
+    void print(const char *text);
+    void print(const __FlashStringHelper *text);
+    void print(char c);
+    void print(long value, int radius = DEC);
+    void print(unsigned long value, int radius = DEC);
+    void print(int value, int radius = DEC) { print((long)value, radius); }
+    void print(unsigned int value, int radius = DEC) { print((unsigned long)value, radius); }
+    void print(double value, int fracDigits = 2);
+
+    void println() { print('\n'); }
+    template <typename T>
+    void println(T value) { print(value); println(); }
+    template <typename T>
+    void println(T value, int arg) { print(value, arg); println(); }
+};
+
+extern HostSerial Serial;   //!< Serial port
+
+#endif // ERRIEZ_LKM1638_HOST_ARDUINO_H_
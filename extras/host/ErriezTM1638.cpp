@@ -0,0 +1,231 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezTM1638.cpp
+ * \brief TM1638 driver for host builds of the LKM1638 library
+ */
+
+#include "ErriezTM1638.h"
+
+// TM1638 commands
+#define TM1638_CMD_WRITE_AUTO   0x40 //!< Write data, auto increment address
+#define TM1638_CMD_READ_KEYS    0x42 //!< Read key-scan data
+#define TM1638_CMD_WRITE_FIXED  0x44 //!< Write data, fixed address
+#define TM1638_CMD_DISPLAY      0x80 //!< Display control
+#define TM1638_CMD_DISPLAY_ON   0x08 //!< Display control: display on
+#define TM1638_CMD_ADDRESS      0xC0 //!< Set address
+
+/*!
+ * \brief TM1638 constructor
+ * \param clkPin Clock pin
+ * \param dioPin Data pin (bi-directional)
+ * \param stbPin Strobe pin (low is enable)
+ * \param displayEnable Display on after begin()
+ * \param brightness Brightness 0..7
+ */
+TM1638::TM1638(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin,
+               bool displayEnable, uint8_t brightness) :
+        _clkPin(clkPin), _dioPin(dioPin), _stbPin(stbPin),
+        _displayOn(displayEnable), _brightness((uint8_t)(brightness & 0x07))
+{
+}
+
+/*!
+ * \brief Initialize pins and write display control
+ */
+void TM1638::begin()
+{
+    digitalWrite(_stbPin, HIGH);
+    pinMode(_stbPin, OUTPUT);
+    digitalWrite(_clkPin, HIGH);
+    pinMode(_clkPin, OUTPUT);
+    pinMode(_dioPin, OUTPUT);
+
+    writeDisplayControl();
+}
+
+/*!
+ * \brief Release pins
+ */
+void TM1638::end()
+{
+    pinMode(_stbPin, INPUT);
+    pinMode(_clkPin, INPUT);
+    pinMode(_dioPin, INPUT);
+}
+
+/*!
+ * \brief Turn display on
+ */
+void TM1638::displayOn()
+{
+    _displayOn = true;
+    writeDisplayControl();
+}
+
+/*!
+ * \brief Turn display off
+ */
+void TM1638::displayOff()
+{
+    _displayOn = false;
+    writeDisplayControl();
+}
+
+/*!
+ * \brief Set brightness
+ * \param brightness Brightness 0..7
+ */
+void TM1638::setBrightness(uint8_t brightness)
+{
+    _brightness = (uint8_t)(brightness & 0x07);
+    writeDisplayControl();
+}
+
+/*!
+ * \brief Clear all 16 display registers with one burst
+ */
+void TM1638::clear()
+{
+    writeCommand(TM1638_CMD_WRITE_AUTO);
+
+    digitalWrite(_stbPin, LOW);
+    writeByte(TM1638_CMD_ADDRESS);
+    for (uint8_t i = 0; i < 16; i++) {
+        writeByte(0x00);
+    }
+    digitalWrite(_stbPin, HIGH);
+}
+
+/*!
+ * \brief Read 4 Byte key-scan registers
+ * \return Key-scan registers, BYTE1 in bits 0..7
+ */
+uint32_t TM1638::getKeys()
+{
+    uint32_t keys = 0;
+
+    digitalWrite(_stbPin, LOW);
+    writeByte(TM1638_CMD_READ_KEYS);
+    pinMode(_dioPin, INPUT);
+    delayMicroseconds(1);
+    for (uint8_t i = 0; i < 4; i++) {
+        keys |= ((uint32_t)readByte() << (i * 8));
+    }
+    pinMode(_dioPin, OUTPUT);
+    digitalWrite(_stbPin, HIGH);
+
+    return keys;
+}
+
+/*!
+ * \brief Write one display register with a fixed address
+ * \param address Register address 0x00..0x0F
+ * \param data Register value
+ */
+void TM1638::writeData(uint8_t address, uint8_t data)
+{
+    writeCommand(TM1638_CMD_WRITE_FIXED);
+
+    digitalWrite(_stbPin, LOW);
+    writeByte((uint8_t)(TM1638_CMD_ADDRESS | (address & 0x0F)));
+    writeByte(data);
+    digitalWrite(_stbPin, HIGH);
+}
+
+/*!
+ * \brief Write display registers with auto increment address
+ * \param address First register address 0x00..0x0F
+ * \param buf Register values
+ * \param len Number of registers
+ */
+void TM1638::writeData(uint8_t address, const uint8_t *buf, uint8_t len)
+{
+    writeCommand(TM1638_CMD_WRITE_AUTO);
+
+    digitalWrite(_stbPin, LOW);
+    writeByte((uint8_t)(TM1638_CMD_ADDRESS | (address & 0x0F)));
+    for (uint8_t i = 0; i < len; i++) {
+        writeByte(buf[i]);
+    }
+    digitalWrite(_stbPin, HIGH);
+}
+
+/*!
+ * \brief Write display on/off and brightness
+ */
+void TM1638::writeDisplayControl()
+{
+    writeCommand((uint8_t)(TM1638_CMD_DISPLAY | _brightness |
+                           (_displayOn ? TM1638_CMD_DISPLAY_ON : 0)));
+}
+
+/*!
+ * \brief Write command in its own STB frame
+ * \param cmd Command
+ */
+void TM1638::writeCommand(uint8_t cmd)
+{
+    digitalWrite(_stbPin, LOW);
+    writeByte(cmd);
+    digitalWrite(_stbPin, HIGH);
+}
+
+/*!
+ * \brief Write Byte, LSB first, data latched on rising clock edge
+ * \param data Byte
+ */
+void TM1638::writeByte(uint8_t data)
+{
+    for (uint8_t i = 0; i < 8; i++) {
+        digitalWrite(_clkPin, LOW);
+        digitalWrite(_dioPin, (data & 0x01) ? HIGH : LOW);
+        delayMicroseconds(1);
+        digitalWrite(_clkPin, HIGH);
+        delayMicroseconds(1);
+        data >>= 1;
+    }
+}
+
+/*!
+ * \brief Read Byte, LSB first, data valid after falling clock edge
+ * \return Byte
+ */
+uint8_t TM1638::readByte()
+{
+    uint8_t data = 0;
+
+    for (uint8_t i = 0; i < 8; i++) {
+        digitalWrite(_clkPin, LOW);
+        delayMicroseconds(1);
+        digitalWrite(_clkPin, HIGH);
+        if (digitalRead(_dioPin) == HIGH) {
+            data |= (uint8_t)(1 << i);
+        }
+        delayMicroseconds(1);
+    }
+
+    return data;
+}
@@ -0,0 +1,74 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezTM1638.h
+ * \brief TM1638 driver for host builds of the LKM1638 library
+ * \details
+ *      Same interface as https://github.com/Erriez/ErriezTM1638. The pins are
+ *      bit-banged with the Arduino pin functions of the host Arduino.h, which
+ *      drive the simulated boards of TM1638Sim.h.
+ */
+
+#ifndef ERRIEZ_TM1638_H_
+#define ERRIEZ_TM1638_H_
+
+#include <Arduino.h>
+
+/*!
+ * \brief TM1638 class
+ */
+class TM1638
+{
+public:
+    TM1638(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin,
+           bool displayEnable = true, uint8_t brightness = 5);
+    virtual ~TM1638() {}
+
+    virtual void begin();
+    virtual void end();
+
+    virtual void displayOn();
+    virtual void displayOff();
+    virtual void setBrightness(uint8_t brightness);
+
+    virtual void clear();
+    virtual uint32_t getKeys();
+    virtual void writeData(uint8_t address, uint8_t data);
+    virtual void writeData(uint8_t address, const uint8_t *buf, uint8_t len);
+
+protected:
+    uint8_t _clkPin;            //!< Clock pin
+    uint8_t _dioPin;            //!< Data pin (bi-directional)
+    uint8_t _stbPin;            //!< Strobe pin (low is enable)
+    bool _displayOn;            //!< Display on
+    uint8_t _brightness;        //!< Brightness 0..7
+
+    void writeDisplayControl();
+    void writeCommand(uint8_t cmd);
+    void writeByte(uint8_t data);
+    uint8_t readByte();
+};
+
+#endif // ERRIEZ_TM1638_H_
@@ -0,0 +1,143 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file HostPort.h
+ * \brief Mocked ATmega328 port registers for host builds
+ * \details
+ *      PORTx, DDRx and PINx objects which forward bit changes to the Arduino
+ *      pin functions of the host Arduino.h, so direct port I/O drives the
+ *      simulated boards of TM1638Sim.h. Include before ErriezLKM1638BoardT.h
+ *      with LKM1638_DIRECT_IO 1.
+ */
+
+#ifndef ERRIEZ_LKM1638_HOST_PORT_H_
+#define ERRIEZ_LKM1638_HOST_PORT_H_
+
+#include <Arduino.h>
+
+/*!
+ * \brief Register type of a HostPort
+ */
+typedef enum {
+    HostPortOutput = 0,         //!< PORTx: output levels
+    HostPortDirection = 1,      //!< DDRx: 1 is output
+    HostPortInput = 2           //!< PINx: input levels
+} HostPortType;
+
+/*!
+ * \brief HostPort class, one 8-bit port register
+ */
+class HostPort
+{
+public:
+    /*!
+     * \brief Constructor
+     * \param firstPin Digital pin of bit 0
+     * \param type Register type
+     */
+    HostPort(uint8_t firstPin, HostPortType type) :
+            _firstPin(firstPin), _type(type), _value(0)
+    {
+    }
+
+    //! \brief Set bits
+    HostPort &operator|=(uint8_t mask)
+    {
+        _value |= mask;
+        write(mask);
+        return *this;
+    }
+
+    //! \brief Clear bits
+    HostPort &operator&=(uint8_t mask)
+    {
+        _value &= mask;
+        write((uint8_t)~mask);
+        return *this;
+    }
+
+    //! \brief Read register, PINx reads the pin levels
+    operator uint8_t() const
+    {
+        uint8_t value = _value;
+
+        if (_type == HostPortInput) {
+            value = 0;
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                if (digitalRead((uint8_t)(_firstPin + bit)) == HIGH) {
+                    value |= (uint8_t)(1 << bit);
+                }
+            }
+        }
+
+        return value;
+    }
+
+private:
+    uint8_t _firstPin;          //!< Digital pin of bit 0
+    HostPortType _type;         //!< Register type
+    uint8_t _value;             //!< Register value
+
+    /*!
+     * \brief Forward written bits to the pins
+     * \details
+     *      Pins are also written with digitalWrite() and pinMode() by the
+     *      TM1638 library, so the bits are forwarded also when the register
+     *      value did not change.
+     * \param mask Written bits
+     */
+    void write(uint8_t mask)
+    {
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            uint8_t pin = (uint8_t)(_firstPin + bit);
+            uint8_t level = (_value & (1 << bit)) ? HIGH : LOW;
+
+            if (!(mask & (1 << bit))) {
+                continue;
+            }
+            if (_type == HostPortOutput) {
+                digitalWrite(pin, level);
+            } else if (_type == HostPortDirection) {
+                pinMode(pin, (level == HIGH) ? OUTPUT : INPUT);
+            }
+        }
+    }
+};
+
+// ATmega328 ports: digital pins 0..7 PORTD, 8..13 PORTB, 14..19 PORTC
+static HostPort PORTB(8, HostPortOutput);   //!< Port B output
+static HostPort PORTC(14, HostPortOutput);  //!< Port C output
+static HostPort PORTD(0, HostPortOutput);   //!< Port D output
+static HostPort DDRB(8, HostPortDirection); //!< Port B direction
+static HostPort DDRC(14, HostPortDirection); //!< Port C direction
+static HostPort DDRD(0, HostPortDirection); //!< Port D direction
+static HostPort PINB(8, HostPortInput);     //!< Port B input
+static HostPort PINC(14, HostPortInput);    //!< Port C input
+static HostPort PIND(0, HostPortInput);     //!< Port D input
+
+//! Pin delay of the direct port I/O
+#define LKM1638_PIN_DELAY()     delayMicroseconds(1)
+
+#endif // ERRIEZ_LKM1638_HOST_PORT_H_
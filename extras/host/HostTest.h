@@ -0,0 +1,73 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file HostTest.h
+ * \brief Checks for the host tests of the LKM1638 library
+ */
+
+#ifndef ERRIEZ_LKM1638_HOST_TEST_H_
+#define ERRIEZ_LKM1638_HOST_TEST_H_
+
+#include <stdio.h>
+
+//! Check condition, print file and line when false
+#define CHECK(cond)     hostCheck((cond), #cond, __FILE__, __LINE__)
+
+static unsigned long hostChecks;    //!< Number of checks
+static unsigned long hostFailures;  //!< Number of failed checks
+
+/*!
+ * \brief Count check and print failures
+ * \param ok Check result
+ * \param expr Checked expression
+ * \param file Source file
+ * \param line Source line
+ * \return ok
+ */
+static inline bool hostCheck(bool ok, const char *expr, const char *file, int line)
+{
+    hostChecks++;
+    if (!ok) {
+        if (hostFailures++ < 20) {
+            printf("%s:%d: check failed: %s\n", file, line, expr);
+        }
+    }
+
+    return ok;
+}
+
+/*!
+ * \brief Print result of a test program
+ * \param name Test name
+ * \return Exit code, 0 when all checks passed
+ */
+static inline int hostResult(const char *name)
+{
+    printf("%s: %lu checks, %lu failures\n", name, hostChecks, hostFailures);
+
+    return (hostFailures == 0) ? 0 : 1;
+}
+
+#endif // ERRIEZ_LKM1638_HOST_TEST_H_
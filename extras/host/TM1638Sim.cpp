@@ -0,0 +1,398 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file TM1638Sim.cpp
+ * \brief Simulated TM1638 for host builds of the LKM1638 library
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "TM1638Sim.h"
+
+// Attached boards
+static TM1638Sim *boards[TM1638_SIM_MAX_BOARDS];
+
+/*!
+ * \brief TM1638Sim constructor
+ * \details
+ *      The board is attached to the pins until destruction. The pins are
+ *      idle high.
+ * \param clkPin Clock pin
+ * \param dioPin Data pin
+ * \param stbPin Strobe pin
+ */
+TM1638Sim::TM1638Sim(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin) :
+        _clkPin(clkPin), _dioPin(dioPin), _stbPin(stbPin), _clk(1), _dio(1), _stb(1),
+        _keys(0), _keyQueueLen(0)
+{
+    reset();
+    resetStats();
+
+    for (uint8_t i = 0; i < TM1638_SIM_MAX_BOARDS; i++) {
+        if (boards[i] == NULL) {
+            boards[i] = this;
+            break;
+        }
+    }
+}
+
+/*!
+ * \brief TM1638Sim destructor
+ */
+TM1638Sim::~TM1638Sim()
+{
+    for (uint8_t i = 0; i < TM1638_SIM_MAX_BOARDS; i++) {
+        if (boards[i] == this) {
+            boards[i] = NULL;
+        }
+    }
+}
+
+/*!
+ * \brief Power-on state: registers cleared, display off
+ */
+void TM1638Sim::reset()
+{
+    memset(_regs, 0, sizeof(_regs));
+    _displayOn = false;
+    _brightness = 0;
+    _autoIncrement = true;
+    _address = 0;
+
+    _shift = 0;
+    _numBits = 0;
+    _numBytes = 0;
+    _addressSet = false;
+    _reading = false;
+    _dioOut = 1;
+}
+
+//------------------------------------------------------------------------------
+// Scripted key-scan registers
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set key-scan registers of all key-scans after the queued key-scans
+ * \param keys Key-scan registers, BYTE1 in bits 0..7
+ */
+void TM1638Sim::setKeys(uint32_t keys)
+{
+    _keys = keys;
+}
+
+/*!
+ * \brief Queue key-scan registers for one key-scan
+ * \details
+ *      Queued key-scans are returned in order, then the setKeys() value.
+ * \param keys Key-scan registers, BYTE1 in bits 0..7
+ * \retval true Queued
+ * \retval false Queue full
+ */
+bool TM1638Sim::queueKeys(uint32_t keys)
+{
+    if (_keyQueueLen >= TM1638_SIM_MAX_KEY_QUEUE) {
+        return false;
+    }
+
+    _keyQueue[_keyQueueLen++] = keys;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// TM1638 state
+//------------------------------------------------------------------------------
+/*!
+ * \brief Get display register
+ * \param address Address 0x00..0x0F
+ * \return Register value
+ */
+uint8_t TM1638Sim::getRegister(uint8_t address)
+{
+    return _regs[address & 0x0F];
+}
+
+/*!
+ * \brief Get all display registers
+ * \return 16 registers, index 0 is address 0x00
+ */
+const uint8_t *TM1638Sim::getRegisters()
+{
+    return _regs;
+}
+
+/*!
+ * \brief Get display on/off
+ * \retval true Display on
+ * \retval false Display off
+ */
+bool TM1638Sim::isDisplayOn()
+{
+    return _displayOn;
+}
+
+/*!
+ * \brief Get brightness
+ * \return Brightness 0..7
+ */
+uint8_t TM1638Sim::getBrightness()
+{
+    return _brightness;
+}
+
+//------------------------------------------------------------------------------
+// Bus traffic
+//------------------------------------------------------------------------------
+/*!
+ * \brief Get bus traffic
+ * \param stats Traffic since construction or resetStats()
+ */
+void TM1638Sim::getStats(TM1638SimStats *stats)
+{
+    *stats = _stats;
+}
+
+/*!
+ * \brief Reset bus traffic counters
+ */
+void TM1638Sim::resetStats()
+{
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+/*!
+ * \brief Get decoded frames
+ * \details
+ *      One line per STB frame in HEX: 'W' followed by the written Bytes, or
+ *      'R' followed by the command and the key-scan Bytes, for example
+ *      "W 44\nW C3 06\nR 42 00 00 00 00\n".
+ * \return Frames since construction or clearTranscript()
+ */
+const std::string &TM1638Sim::getTranscript()
+{
+    return _transcript;
+}
+
+/*!
+ * \brief Clear decoded frames
+ */
+void TM1638Sim::clearTranscript()
+{
+    _transcript.clear();
+}
+
+//------------------------------------------------------------------------------
+// Pin changes
+//------------------------------------------------------------------------------
+/*!
+ * \brief Pin level written by the controller
+ * \param pin Pin
+ * \param level LOW or HIGH
+ */
+void TM1638Sim::pinChanged(uint8_t pin, uint8_t level)
+{
+    for (uint8_t i = 0; i < TM1638_SIM_MAX_BOARDS; i++) {
+        TM1638Sim *board = boards[i];
+
+        if (board == NULL) {
+            continue;
+        }
+        if (pin == board->_dioPin) {
+            board->_dio = level;
+        }
+        if (pin == board->_stbPin) {
+            board->stbChanged(level);
+        }
+        if (pin == board->_clkPin) {
+            board->clkChanged(level);
+        }
+    }
+}
+
+/*!
+ * \brief Get pin level driven by a board
+ * \param pin Pin
+ * \param level Level driven on DIO during a key-scan
+ * \retval true Pin driven by a board
+ * \retval false Pin not driven
+ */
+bool TM1638Sim::pinDriven(uint8_t pin, uint8_t *level)
+{
+    for (uint8_t i = 0; i < TM1638_SIM_MAX_BOARDS; i++) {
+        TM1638Sim *board = boards[i];
+
+        if ((board != NULL) && (pin == board->_dioPin) && (board->_stb == 0) &&
+            board->_reading) {
+            *level = board->_dioOut;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Frame decoder
+//------------------------------------------------------------------------------
+/*!
+ * \brief STB changed, low starts and high ends a frame
+ * \param level STB level
+ */
+void TM1638Sim::stbChanged(uint8_t level)
+{
+    if (level == _stb) {
+        return;
+    }
+    _stb = level;
+
+    if (level == 0) {
+        _shift = 0;
+        _numBits = 0;
+        _numBytes = 0;
+        _addressSet = false;
+        _reading = false;
+        return;
+    }
+
+    if (_numBits != 0) {
+        _stats.errors++;
+    }
+    if ((_numBytes != 0) || (_numBits != 0)) {
+        _stats.frames++;
+        _transcript += '\n';
+    }
+    _reading = false;
+}
+
+/*!
+ * \brief CLK changed, data is latched on the rising edge
+ * \param level CLK level
+ */
+void TM1638Sim::clkChanged(uint8_t level)
+{
+    if (level == _clk) {
+        return;
+    }
+    _clk = level;
+
+    if (_stb != 0) {
+        return;
+    }
+    _stats.clkEdges++;
+
+    if (_reading) {
+        // Key-scan: next bit on falling edge, controller reads after rising edge
+        uint8_t byteIndex = (uint8_t)(_numBytes - 1);
+        uint8_t data = (byteIndex < sizeof(_readData)) ? _readData[byteIndex] : 0;
+
+        if (level == 0) {
+            _dioOut = (uint8_t)((data >> _numBits) & 0x01);
+        } else if (++_numBits == 8) {
+            _numBits = 0;
+            _numBytes++;
+            _stats.bytes++;
+            appendByte(data);
+        }
+        return;
+    }
+
+    if (level != 0) {
+        // Write: LSB first
+        _shift = (uint8_t)((_shift >> 1) | (_dio ? 0x80 : 0x00));
+        if (++_numBits == 8) {
+            _numBits = 0;
+            receiveByte(_shift);
+        }
+    }
+}
+
+/*!
+ * \brief Execute a received Byte
+ * \param data Command or data Byte
+ */
+void TM1638Sim::receiveByte(uint8_t data)
+{
+    _stats.bytes++;
+    appendByte(data);
+
+    if (_numBytes++ != 0) {
+        // Data Byte after an address command
+        if (_addressSet) {
+            _regs[_address] = data;
+            if (_autoIncrement) {
+                _address = (uint8_t)((_address + 1) & 0x0F);
+            }
+        }
+        return;
+    }
+
+    // First Byte of a frame is a command
+    switch (data & 0xC0) {
+        case 0x40:
+            // Data command
+            _autoIncrement = ((data & 0x04) == 0);
+            if (data & 0x02) {
+                uint32_t keys = _keys;
+
+                if (_keyQueueLen > 0) {
+                    keys = _keyQueue[0];
+                    memmove(&_keyQueue[0], &_keyQueue[1], --_keyQueueLen * sizeof(uint32_t));
+                }
+                for (uint8_t i = 0; i < sizeof(_readData); i++) {
+                    _readData[i] = (uint8_t)(keys >> (i * 8));
+                }
+                _reading = true;
+                _stats.keyScans++;
+            }
+            break;
+        case 0x80:
+            // Display control command
+            _displayOn = ((data & 0x08) != 0);
+            _brightness = (uint8_t)(data & 0x07);
+            break;
+        case 0xC0:
+            // Address command
+            _address = (uint8_t)(data & 0x0F);
+            _addressSet = true;
+            break;
+        default:
+            break;
+    }
+}
+
+/*!
+ * \brief Append a Byte to the transcript
+ * \param data Byte
+ */
+void TM1638Sim::appendByte(uint8_t data)
+{
+    char text[4];
+
+    if ((_numBytes == 0) && (_numBits == 0) && !_reading) {
+        _transcript += ((data & 0xC2) == 0x42) ? 'R' : 'W';
+    }
+    snprintf(text, sizeof(text), " %02X", data);
+    _transcript += text;
+}
@@ -0,0 +1,124 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file TM1638Sim.h
+ * \brief Simulated TM1638 for host builds of the LKM1638 library
+ * \details
+ *      Decodes the CLK, DIO and STB pin changes of the Arduino pin functions
+ *      into TM1638 commands and a register image, and returns scripted
+ *      key-scan Bytes. Multiple boards can share CLK and DIO with their own
+ *      STB pin.
+ */
+
+#ifndef ERRIEZ_LKM1638_HOST_TM1638_SIM_H_
+#define ERRIEZ_LKM1638_HOST_TM1638_SIM_H_
+
+#include <stdint.h>
+#include <string>
+
+#define TM1638_SIM_MAX_BOARDS     8  //!< Maximum number of simulated boards
+#define TM1638_SIM_MAX_KEY_QUEUE  16 //!< Maximum number of queued key-scans
+
+/*!
+ * \brief Bus traffic of one simulated board
+ */
+typedef struct {
+    uint32_t clkEdges;          //!< Rising and falling CLK edges during frames
+    uint32_t bytes;             //!< Bytes written and read, including commands
+    uint32_t frames;            //!< STB frames
+    uint32_t keyScans;          //!< Key-scan frames
+    uint32_t errors;            //!< Frames which end with an incomplete Byte
+} TM1638SimStats;
+
+/*!
+ * \brief TM1638Sim class
+ */
+class TM1638Sim
+{
+public:
+    // Constructor and destructor, attach to and detach from the pins
+    TM1638Sim(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin);
+    ~TM1638Sim();
+
+    // Power-on state, keeps the bus traffic
+    void reset();
+
+    // Scripted key-scan registers, BYTE1 in bits 0..7
+    void setKeys(uint32_t keys);
+    bool queueKeys(uint32_t keys);
+
+    // TM1638 state
+    uint8_t getRegister(uint8_t address);
+    const uint8_t *getRegisters();
+    bool isDisplayOn();
+    uint8_t getBrightness();
+
+    // Bus traffic
+    void getStats(TM1638SimStats *stats);
+    void resetStats();
+    const std::string &getTranscript();
+    void clearTranscript();
+
+    // Called by the Arduino pin functions
+    static void pinChanged(uint8_t pin, uint8_t level);
+    static bool pinDriven(uint8_t pin, uint8_t *level);
+
+private:
+    uint8_t _clkPin;            //!< Clock pin
+    uint8_t _dioPin;            //!< Data pin
+    uint8_t _stbPin;            //!< Strobe pin
+    uint8_t _clk;               //!< Clock level
+    uint8_t _dio;               //!< Data level written by the controller
+    uint8_t _stb;               //!< Strobe level
+
+    uint8_t _regs[16];          //!< Display registers
+    bool _displayOn;            //!< Display on
+    uint8_t _brightness;        //!< Brightness 0..7
+    bool _autoIncrement;        //!< Address mode of the last data command
+    uint8_t _address;           //!< Address of the next data Byte
+
+    uint32_t _keys;             //!< Key-scan registers when the queue is empty
+    uint32_t _keyQueue[TM1638_SIM_MAX_KEY_QUEUE]; //!< Scripted key-scans
+    uint8_t _keyQueueLen;       //!< Number of queued key-scans
+
+    // Frame decoder
+    uint8_t _shift;             //!< Byte being shifted in or out
+    uint8_t _numBits;           //!< Bits of the current Byte
+    uint8_t _numBytes;          //!< Bytes of the current frame
+    bool _addressSet;           //!< Address command received in this frame
+    bool _reading;              //!< Key-scan frame after the command Byte
+    uint8_t _readData[4];       //!< Key-scan Bytes of the current frame
+    uint8_t _dioOut;            //!< Data level driven by the TM1638
+
+    TM1638SimStats _stats;      //!< Bus traffic
+    std::string _transcript;    //!< Decoded frames, one line per frame
+
+    void stbChanged(uint8_t level);
+    void clkChanged(uint8_t level);
+    void receiveByte(uint8_t data);
+    void appendByte(uint8_t data);
+};
+
+#endif // ERRIEZ_LKM1638_HOST_TM1638_SIM_H_
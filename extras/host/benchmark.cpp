@@ -0,0 +1,163 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file benchmark.cpp
+ * \brief Bus cost of the public LKM1638Board functions on a simulated TM1638
+ * \details
+ *      Every function is called once after clear() and once more with the
+ *      same arguments. Both calls are decoded by TM1638Sim and printed as CSV
+ *      with clock edges, Bytes, STB frames and the estimated bus time:
+ *      one bit period per clock cycle and per STB frame.
+ *
+ *      Usage: benchmark [bit period in ns, default 1000]
+ *
+ *      'make check' compares the output with benchmark.csv, so a change of
+ *      the bus cost of a function fails until benchmark.csv is updated.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <ErriezLKM1638Board.h>
+
+#include "TM1638Sim.h"
+
+// Measure first and repeated call of a statement after a setup statement
+#define BENCHMARK(name, setup, statement)               \
+    do {                                                \
+        TM1638SimStats first;                           \
+        prepare();                                      \
+        setup;                                          \
+        sim.resetStats();                               \
+        statement;                                      \
+        sim.getStats(&first);                           \
+        sim.resetStats();                               \
+        statement;                                      \
+        printResult(name, &first);                      \
+    } while (0)
+
+static TM1638Sim sim(2, 3, 4);
+static LKM1638Board lkm1638(2, 3, 4);
+static unsigned long bitPeriodNs = 1000;
+
+static void prepare()
+{
+    lkm1638.setBuffered(false);
+    lkm1638.clear();
+    lkm1638.setPrintPos(0);
+}
+
+static void printResult(const char *name, const TM1638SimStats *first)
+{
+    TM1638SimStats repeat;
+    unsigned long busNs;
+
+    sim.getStats(&repeat);
+    busNs = ((first->clkEdges / 2) + first->frames) * bitPeriodNs;
+
+    printf("%s,%u,%u,%u,%lu.%03lu,%u,%u,%u\n", name,
+           first->clkEdges, first->bytes, first->frames, busNs / 1000, busNs % 1000,
+           repeat.clkEdges, repeat.bytes, repeat.frames);
+}
+
+int main(int argc, char *argv[])
+{
+    volatile uint8_t buttons;
+
+    if (argc > 1) {
+        bitPeriodNs = strtoul(argv[1], NULL, 0);
+    }
+
+    lkm1638.begin();
+
+    printf("name,clk_edges,bytes,frames,bus_us,repeat_clk_edges,repeat_bytes,repeat_frames\n");
+
+    // Unsigned print
+    BENCHMARK("print(uint8_t)", , lkm1638.print((uint8_t)123));
+    BENCHMARK("print(uint8_t,HEX)", , lkm1638.print((uint8_t)123, HEX));
+    BENCHMARK("print(uint8_t,DEC,3)", , lkm1638.print((uint8_t)123, DEC, 3));
+    BENCHMARK("print(uint8_t,DEC,3,3)", , lkm1638.print((uint8_t)123, DEC, 3, 3));
+    BENCHMARK("print(uint16_t)", , lkm1638.print((uint16_t)12345));
+    BENCHMARK("print(uint16_t,HEX)", , lkm1638.print((uint16_t)12345, HEX));
+    BENCHMARK("print(uint16_t,DEC,5)", , lkm1638.print((uint16_t)12345, DEC, 5));
+    BENCHMARK("print(uint16_t,DEC,5,5)", , lkm1638.print((uint16_t)12345, DEC, 5, 5));
+    BENCHMARK("print(unsigned long)", , lkm1638.print(12345678UL));
+    BENCHMARK("print(unsigned long,HEX)", , lkm1638.print(12345678UL, HEX));
+    BENCHMARK("print(unsigned long,DEC,8)", , lkm1638.print(12345678UL, DEC, 8));
+    BENCHMARK("print(unsigned long,DEC,8,8)", , lkm1638.print(12345678UL, DEC, 8, 8));
+
+    // Signed print
+    BENCHMARK("print(int8_t)", , lkm1638.print((int8_t)-123));
+    BENCHMARK("print(int8_t,HEX)", , lkm1638.print((int8_t)-123, HEX));
+    BENCHMARK("print(int8_t,DEC,4)", , lkm1638.print((int8_t)-123, DEC, 4));
+    BENCHMARK("print(int16_t)", , lkm1638.print((int16_t)-12345));
+    BENCHMARK("print(int16_t,HEX)", , lkm1638.print((int16_t)-12345, HEX));
+    BENCHMARK("print(int16_t,DEC,6)", , lkm1638.print((int16_t)-12345, DEC, 6));
+    BENCHMARK("print(long)", , lkm1638.print(-1234567L));
+    BENCHMARK("print(long,HEX)", , lkm1638.print(-1234567L, HEX));
+    BENCHMARK("print(long,DEC,8)", , lkm1638.print(-1234567L, DEC, 8));
+
+    // Compile-time print, text, fixed point and float
+    BENCHMARK("print<DEC,5,1>(uint16_t)", , (lkm1638.print<DEC, 5, 1>((uint16_t)12345)));
+    BENCHMARK("print(const char *)", , lkm1638.print("Err 42"));
+    BENCHMARK("print(F())", , lkm1638.print(F("Err 42")));
+    BENCHMARK("printFixed(long,2)", , lkm1638.printFixed(-1234L, 2));
+    BENCHMARK("printFloat(float,2)", , lkm1638.printFloat(-12.34f, 2));
+
+    // Segments, dots and refresh
+    BENCHMARK("setSegmentsDigit()", , lkm1638.setSegmentsDigit(0, SEGMENTS_MINUS));
+    BENCHMARK("setDigit()", , lkm1638.setDigit(0, 8));
+    BENCHMARK("dotOn()", , lkm1638.dotOn(0));
+    BENCHMARK("dotOff()", lkm1638.dotOn(0), lkm1638.dotOff(0));
+    BENCHMARK("setDots()", lkm1638.print(12345678UL), lkm1638.setDots(0x55));
+    BENCHMARK("refresh()", lkm1638.print(12345678UL), lkm1638.refresh());
+
+    // Dual color LED's
+    BENCHMARK("setColorLED()", , lkm1638.setColorLED(0, LedRed));
+    BENCHMARK("setColorLEDs()", , lkm1638.setColorLEDs(0x0F, 0xF0));
+    BENCHMARK("colorLEDsOn(0xFF)", , lkm1638.colorLEDsOn(0xFF, LedGreen));
+    BENCHMARK("colorLEDsOff(0xFF)", lkm1638.colorLEDsOn(0xFF, LedRed),
+              lkm1638.colorLEDsOff(0xFF));
+
+    // Clear and buttons
+    BENCHMARK("clear()", , lkm1638.clear());
+    BENCHMARK("getButtons()", , buttons = lkm1638.getButtons());
+    (void)buttons;
+
+    // Buffered mode, written with one flush
+    BENCHMARK("buffered print(unsigned long)+flush()", lkm1638.setBuffered(true),
+              lkm1638.print(12345678UL); lkm1638.flush());
+    BENCHMARK("buffered setDots()+flush()", lkm1638.setBuffered(true),
+              lkm1638.setDots(0x55); lkm1638.flush());
+    BENCHMARK("buffered colorLEDsOn(0xFF)+flush()", lkm1638.setBuffered(true),
+              lkm1638.colorLEDsOn(0xFF, LedRed); lkm1638.flush());
+
+    // Update transaction with reverted changes
+    BENCHMARK("colorLEDsOff(0xFF)+colorLEDsOn() update", lkm1638.colorLEDsOn(0x01, LedRed),
+              lkm1638.beginUpdate(); lkm1638.colorLEDsOff(0xFF);
+              lkm1638.colorLEDsOn(0x01, LedRed); lkm1638.endUpdate());
+
+    return 0;
+}
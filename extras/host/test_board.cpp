@@ -0,0 +1,208 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file test_board.cpp
+ * \brief LKM1638Board on a simulated TM1638: rendered registers and buttons
+ */
+
+#include <ErriezLKM1638Board.h>
+#include <ErriezLKM1638Frame.h>
+
+#include "HostTest.h"
+#include "TM1638Sim.h"
+
+static TM1638Sim sim(2, 3, 4);
+static LKM1638Board lkm1638(2, 3, 4);
+
+// Board with 4 digits and 4 dual color LED's
+static TM1638Sim sim4(2, 3, 5);
+static LKM1638Board lkm1638Small(2, 3, 5, 4, 4);
+
+static void testBegin()
+{
+    TM1638SimStats stats;
+
+    lkm1638.begin();
+
+    // Display control on with default brightness, registers cleared
+    CHECK(sim.isDisplayOn());
+    CHECK(sim.getBrightness() == 5);
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        CHECK(sim.getRegister(address) == 0);
+    }
+    CHECK(!lkm1638.isFlushing());
+
+    sim.getStats(&stats);
+    CHECK(stats.errors == 0);
+    CHECK(sim.getTranscript() ==
+          "W 8D\n"
+          "W 40\n"
+          "W C0 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00\n");
+}
+
+static void testPrint()
+{
+    lkm1638.setPrintPos(0);
+    lkm1638.print(12345678UL);
+
+    for (uint8_t pos = 0; pos < NUM_DIGITS; pos++) {
+        CHECK(sim.getRegister(LKM1638_DIGIT_ADDRESS(pos)) ==
+              LKM1638Board::getDigitSegments((uint8_t)(8 - pos)));
+    }
+
+    lkm1638.dotOn(2);
+    CHECK(sim.getRegister(LKM1638_DIGIT_ADDRESS(2)) ==
+          (LKM1638Board::getDigitSegments(6) | 0x80));
+}
+
+static void testFixed()
+{
+    // Too many fraction digits display an overflow, not a blank field
+    lkm1638.setPrintPos(0);
+    lkm1638.printFixed(5, 255);
+    for (uint8_t pos = 0; pos < NUM_DIGITS; pos++) {
+        CHECK(sim.getRegister(LKM1638_DIGIT_ADDRESS(pos)) == SEGMENTS_MINUS);
+    }
+
+    lkm1638.printFixed(5, NUM_DIGITS);
+    CHECK(sim.getRegister(LKM1638_DIGIT_ADDRESS(0)) == SEGMENTS_MINUS);
+
+    // Largest number of fraction digits: 0.0000005
+    lkm1638.printFixed(5, NUM_DIGITS - 1);
+    CHECK(sim.getRegister(LKM1638_DIGIT_ADDRESS(0)) == LKM1638Board::getDigitSegments(5));
+    CHECK(sim.getRegister(LKM1638_DIGIT_ADDRESS(NUM_DIGITS - 1)) ==
+          (LKM1638Board::getDigitSegments(0) | 0x80));
+}
+
+static void testColorLED()
+{
+    TM1638SimStats stats;
+
+    sim.resetStats();
+    sim.clearTranscript();
+    lkm1638.setColorLED(0, LedRed);
+
+    // Fixed address write: command frame, address and data frame
+    sim.getStats(&stats);
+    CHECK(sim.getRegister(LKM1638_LED_ADDRESS(0)) == LedRed);
+    CHECK(stats.frames == 2);
+    CHECK(stats.bytes == 3);
+    CHECK(stats.clkEdges == 3 * 16);
+    CHECK(sim.getTranscript() == "W 44\nW CF 01\n");
+}
+
+static void testBuffered()
+{
+    TM1638SimStats stats;
+
+    lkm1638.setBuffered(true);
+    sim.resetStats();
+    lkm1638.setColorLEDs(0x0F, 0xF0);
+    lkm1638.setPrintPos(0);
+    lkm1638.print((uint8_t)42);
+
+    // Nothing written until flush()
+    sim.getStats(&stats);
+    CHECK(stats.frames == 0);
+    CHECK(sim.getRegister(LKM1638_LED_ADDRESS(3)) == 0);
+
+    lkm1638.flush();
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        CHECK(sim.getRegister(address) == lkm1638.getRegister(address));
+    }
+    CHECK(!lkm1638.isFlushing());
+
+    lkm1638.setBuffered(false);
+}
+
+static void testButtons()
+{
+    // Every button alone, S1 in BYTE1 bit 0 is the most left button
+    for (uint8_t button = 0; button < 8; button++) {
+        uint8_t byteIndex = (uint8_t)(button % 4);
+        uint8_t bit = (uint8_t)((button / 4) * 4);
+
+        sim.queueKeys(1UL << ((byteIndex * 8) + bit));
+        CHECK(lkm1638.getButtons() == (uint8_t)(0x80 >> button));
+    }
+
+    // Scripted sequence, then the held key state
+    sim.setKeys(0);
+    sim.queueKeys(0x11111111UL);
+    sim.queueKeys(0x00000001UL);
+    CHECK(lkm1638.getButtons() == 0xFF);
+    CHECK(lkm1638.getButtons() == 0x80);
+    CHECK(lkm1638.getButtons() == 0x00);
+    CHECK(sim.getTranscript().find("R 42 01 00 00 00\n") != std::string::npos);
+}
+
+static void testBoardSize()
+{
+    LKM1638Frame frame(4, 4);
+
+    lkm1638Small.begin();
+    CHECK(lkm1638Small.getNumDigits() == 4);
+    CHECK(lkm1638Small.getNumColorLEDs() == 4);
+
+    // Digit 0 is the most right digit of 4
+    lkm1638Small.setPrintPos(0);
+    lkm1638Small.print(1234UL);
+    CHECK(sim4.getRegister(6) == LKM1638Board::getDigitSegments(4));
+    CHECK(sim4.getRegister(0) == LKM1638Board::getDigitSegments(1));
+    lkm1638Small.setColorLED(0, LedRed);
+    CHECK(sim4.getRegister(7) == LedRed);
+
+    // Overflow of 4 digits, LED 4 does not exist
+    lkm1638Small.print(12345UL);
+    lkm1638Small.setColorLED(4, LedRed);
+    for (uint8_t pos = 0; pos < 4; pos++) {
+        CHECK(sim4.getRegister((uint8_t)(pos << 1)) == SEGMENTS_MINUS);
+    }
+    for (uint8_t address = 8; address < NUM_REGISTERS; address++) {
+        CHECK(sim4.getRegister(address) == 0);
+    }
+
+    // Frame with the same size
+    frame.print(0, 42UL, DEC, 4, 1);
+    frame.setColorLED(3, LedGreen);
+    lkm1638Small.blit(frame);
+    CHECK(sim4.getRegister(6) == LKM1638Board::getDigitSegments(2));
+    CHECK(sim4.getRegister(4) == LKM1638Board::getDigitSegments(4));
+    CHECK(sim4.getRegister(1) == LedGreen);
+    CHECK(sim4.getRegister(7) == LedOff);
+}
+
+int main()
+{
+    testBegin();
+    testPrint();
+    testFixed();
+    testColorLED();
+    testBuffered();
+    testButtons();
+    testBoardSize();
+
+    return hostResult("test_board");
+}
@@ -0,0 +1,154 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file test_boardt.cpp
+ * \brief LKM1638BoardT direct port I/O against LKM1638Board bus transcripts
+ * \details
+ *      LKM1638BoardT is built with the ATmega328 direct port I/O on mocked
+ *      port registers, see HostPort.h. Both boards run the same calls on
+ *      their own simulated TM1638, which must decode identical frames,
+ *      clock edges and registers.
+ */
+
+#define LKM1638_DIRECT_IO   1
+
+#include "HostPort.h"
+
+#include <ErriezLKM1638BoardT.h>
+
+#include "HostTest.h"
+#include "TM1638Sim.h"
+
+// Runtime pins, and compile-time pins on PORTB, PORTC and PORTD
+static TM1638Sim simRuntime(2, 3, 4);
+static TM1638Sim simDirect(8, 15, 5);
+static LKM1638Board runtimeBoard(2, 3, 4);
+static LKM1638BoardT<8, 15, 5> directBoard;
+
+static void run(LKM1638Board &board, TM1638Sim &sim, unsigned int seed)
+{
+    static const uint8_t regs[] = { 0x5B, 0x02 };
+
+    board.begin();
+    board.setBrightness(3);
+
+    board.setPrintPos(0);
+    board.print(12345678UL);
+    board.print(-1234L, HEX);
+    board.setColorLEDs(0x0F, 0xF0);
+    board.colorLEDsOn(0x81, LedRed);
+    board.setDots(0x55);
+    board.refresh();
+
+    board.setBuffered(true);
+    board.print((uint16_t)4321);
+    board.setColorLED(3, LedGreen);
+    board.flush();
+    board.print(87654321UL);
+    while (board.poll()) {
+    }
+    board.setBuffered(false);
+
+    board.beginUpdate();
+    board.colorLEDsOff(0xFF);
+    board.colorLEDsOn(0x01, LedRed);
+    board.endUpdate();
+
+    for (uint8_t i = 0; i < 8; i++) {
+        sim.queueKeys(0x11UL << (i * 4));
+        board.getButtons();
+    }
+
+    // Random calls
+    srand(seed);
+    for (uint16_t i = 0; i < 2000; i++) {
+        uint8_t arg = (uint8_t)rand();
+
+        switch (rand() % 8) {
+            case 0:
+                board.setPrintPos(arg % NUM_DIGITS);
+                board.print((unsigned long)rand(), (arg & 1) ? HEX : DEC);
+                break;
+            case 1:
+                board.setColorLED(arg % NUM_COLOR_LEDS, (LedColor)(rand() % 3));
+                break;
+            case 2:
+                board.setDots(arg);
+                break;
+            case 3:
+                sim.setKeys((uint32_t)rand());
+                board.getButtons();
+                break;
+            case 4:
+                board.setBuffered(arg & 1);
+                break;
+            case 5:
+                board.flush();
+                break;
+            case 6:
+                board.setSegmentsDigit(arg % NUM_DIGITS, (uint8_t)rand());
+                break;
+            default:
+                board.colorLEDsOn(arg, (LedColor)(rand() % 3));
+                break;
+        }
+    }
+
+    // Address out of range, only the low nibble is used
+    board.writeData(0x12, 0x3F);
+    board.writeData(0x1E, regs, sizeof(regs));
+
+    board.setBuffered(false);
+    board.clear();
+    board.displayOff();
+}
+
+int main()
+{
+    TM1638SimStats runtimeStats;
+    TM1638SimStats directStats;
+
+    run(runtimeBoard, simRuntime, 1);
+    run(directBoard, simDirect, 1);
+
+    simRuntime.getStats(&runtimeStats);
+    simDirect.getStats(&directStats);
+
+    CHECK(simRuntime.getTranscript() == simDirect.getTranscript());
+    CHECK(runtimeStats.clkEdges == directStats.clkEdges);
+    CHECK(runtimeStats.bytes == directStats.bytes);
+    CHECK(runtimeStats.frames == directStats.frames);
+    CHECK(runtimeStats.keyScans == directStats.keyScans);
+    CHECK(runtimeStats.errors == 0);
+    CHECK(directStats.errors == 0);
+    CHECK(memcmp(simRuntime.getRegisters(), simDirect.getRegisters(), NUM_REGISTERS) == 0);
+    CHECK(simRuntime.isDisplayOn() == simDirect.isDisplayOn());
+    CHECK(runtimeStats.frames > 1000);
+
+    printf("test_boardt: %u frames, %u Bytes, %u key-scans compared\n",
+           directStats.frames, directStats.bytes, directStats.keyScans);
+
+    return hostResult("test_boardt");
+}
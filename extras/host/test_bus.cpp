@@ -0,0 +1,191 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file test_bus.cpp
+ * \brief LKM1638BusBoard on a LKM1638FakeBus, GPIO calls of LKM1638GpioBus
+ */
+
+#include <ErriezLKM1638BusBoard.h>
+#include <ErriezLKM1638FakeBus.h>
+#include <ErriezLKM1638Frame.h>
+#include <ErriezLKM1638GpioBus.h>
+#include <ErriezLKM1638LinuxGpio.h>
+
+#include "HostTest.h"
+
+static LKM1638FakeBus bus;
+static LKM1638BusBoard lkm1638(bus);
+
+/*!
+ * \brief GPIO lines which count the calls, DIO reads high
+ */
+class CountGpio : public LKM1638Gpio
+{
+public:
+    unsigned long numWrites;    //!< Number of write() calls
+    unsigned long numReads;     //!< Number of read() calls
+    unsigned long numSetInputs; //!< Number of setInputs() calls
+
+    CountGpio() { reset(); }
+
+    void reset() { numWrites = numReads = numSetInputs = 0; }
+    unsigned long getNumCalls() { return numWrites + numReads + numSetInputs; }
+
+    virtual void write(uint8_t, uint8_t) { numWrites++; }
+    virtual uint8_t read(uint8_t mask) { numReads++; return mask; }
+    virtual void setInputs(uint8_t) { numSetInputs++; }
+};
+
+static void testBegin()
+{
+    lkm1638.begin();
+
+    // Display control, then all registers cleared with one burst
+    CHECK(bus.isActive());
+    CHECK(bus.isDisplayOn());
+    CHECK(bus.getBrightness() == LKM1638_BUS_BRIGHTNESS);
+    CHECK(bus.getNumFrames() == 3);
+    CHECK(bus.getNumBytes() == 1 + 1 + 1 + NUM_REGISTERS);
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        CHECK(bus.getRegister(address) == 0);
+    }
+}
+
+static void testPrint()
+{
+    lkm1638.setPrintPos(0);
+    lkm1638.print(1234UL);
+    CHECK(bus.getRegister(LKM1638_DIGIT_ADDRESS(0)) == LKM1638Board::getDigitSegments(4));
+    CHECK(bus.getRegister(LKM1638_DIGIT_ADDRESS(3)) == LKM1638Board::getDigitSegments(1));
+
+    lkm1638.setColorLED(7, LedRed);
+    CHECK(bus.getRegister(LKM1638_LED_ADDRESS(7)) == LedRed);
+
+    bus.setKeys(0x00000001UL);
+    CHECK(lkm1638.getButtons() == 0x80);
+    bus.setKeys(0);
+}
+
+static void testText()
+{
+    LKM1638Frame frame;
+
+    // Flash strings and radius names also without the Arduino core
+    lkm1638.setPrintPos(0);
+    lkm1638.print(F("Err"));
+    CHECK(bus.getRegister(LKM1638_DIGIT_ADDRESS(2)) == LKM1638Board::getCharSegments('E'));
+
+    frame.print(0, 0xABUL, HEX, NUM_DIGITS, 0);
+    lkm1638.blit(frame);
+    CHECK(bus.getRegister(LKM1638_DIGIT_ADDRESS(0)) == LKM1638Board::getDigitSegments(0x0B));
+    CHECK(bus.getRegister(LKM1638_DIGIT_ADDRESS(1)) == LKM1638Board::getDigitSegments(0x0A));
+}
+
+static void testBeginAgain()
+{
+    // Pending changes and an open update are dropped by begin()
+    lkm1638.setBuffered(true);
+    lkm1638.beginUpdate();
+    lkm1638.print(5678UL);
+    lkm1638.begin();
+
+    CHECK(!lkm1638.isUpdating());
+    CHECK(!lkm1638.isFlushing());
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        CHECK(bus.getRegister(address) == 0);
+        CHECK(lkm1638.getRegister(address) == 0);
+    }
+
+    // Shadow registers and board start with the same image
+    lkm1638.setSegmentsDigit(0, SEGMENTS_OFF);
+    CHECK(!lkm1638.isFlushing());
+    lkm1638.setBuffered(false);
+
+    lkm1638.end();
+    CHECK(!bus.isActive());
+}
+
+static void testGpioCalls()
+{
+    CountGpio gpio;
+    LKM1638GpioBus gpioBus(gpio);
+    uint8_t data[1 + NUM_REGISTERS] = { 0xC0 };
+    uint8_t keys[4];
+
+    // 2 calls per written bit, 2 for STB
+    gpioBus.write(data, 1);
+    CHECK(gpio.getNumCalls() == 2 + 16);
+
+    // Display burst
+    gpio.reset();
+    gpioBus.write(data, sizeof(data));
+    CHECK(gpio.numWrites == 2 + 16 * sizeof(data));
+    CHECK(gpio.getNumCalls() == 274);
+
+    // Keys: 3 calls per read bit, 2 to turn DIO around
+    gpio.reset();
+    gpioBus.read(0x42, keys, sizeof(keys));
+    CHECK(gpio.numWrites == 2 + 16 + 16 * sizeof(keys));
+    CHECK(gpio.numReads == 8 * sizeof(keys));
+    CHECK(gpio.numSetInputs == 2);
+    CHECK(gpio.getNumCalls() == 116);
+    CHECK(keys[0] == 0xFF);
+}
+
+static void testGpioError()
+{
+#if defined(__linux__) && !defined(ARDUINO)
+    LKM1638LinuxGpio gpio("/dev/gpiochip-none", 17, 27, 22);
+    LKM1638GpioBus gpioBus(gpio);
+    LKM1638BusBoard board(gpioBus);
+
+    // Transfers without requested lines are reported
+    CHECK(!gpio.begin());
+    board.clearBusError();
+    CHECK(!board.isBusError());
+    board.begin();
+    CHECK(board.isBusError());
+    board.clearBusError();
+    CHECK(board.getButtons() == 0);
+    CHECK(board.isBusError());
+    board.clearBusError();
+    CHECK(!gpio.isError());
+#endif
+
+    // Buses without error detection
+    CHECK(!lkm1638.isBusError());
+}
+
+int main()
+{
+    testBegin();
+    testPrint();
+    testText();
+    testBeginAgain();
+    testGpioCalls();
+    testGpioError();
+
+    return hostResult(LKM1638_TM1638 ? "test_bus" : "test_bus LKM1638_TM1638=0");
+}
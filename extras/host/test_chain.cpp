@@ -0,0 +1,141 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file test_chain.cpp
+ * \brief LKM1638Chain on two simulated TM1638 boards: signed values, buttons
+ */
+
+#include <ErriezLKM1638Chain.h>
+
+#include "HostTest.h"
+#include "TM1638Sim.h"
+
+static TM1638Sim sim0(2, 3, 4);
+static TM1638Sim sim1(5, 6, 7);
+
+static LKM1638Board boards[] = {
+    LKM1638Board(2, 3, 4),
+    LKM1638Board(5, 6, 7)
+};
+static LKM1638Chain chain(boards, 2);
+
+// 4-digit board with 4 LED's right of an 8-digit board
+static TM1638Sim simSmall(8, 9, 10);
+static TM1638Sim simLarge(8, 9, 11);
+
+static LKM1638Board mixedBoards[] = {
+    LKM1638Board(8, 9, 10, 4, 4),
+    LKM1638Board(8, 9, 11)
+};
+static LKM1638Chain mixedChain(mixedBoards, 2);
+
+static uint8_t digitRegister(uint8_t pos)
+{
+    TM1638Sim &sim = (pos < NUM_DIGITS) ? sim0 : sim1;
+
+    return sim.getRegister(LKM1638_DIGIT_ADDRESS(pos % NUM_DIGITS));
+}
+
+static void testSigned()
+{
+    // Minus char on board 1
+    chain.setPrintPos(5);
+    chain.print(-1234L, DEC, 5);
+    chain.flush();
+    CHECK(digitRegister(9) == SEGMENTS_MINUS);
+    CHECK(digitRegister(8) == LKM1638Board::getDigitSegments(1));
+
+    // Positive value in a smaller area hides the old minus char
+    chain.print(56L, DEC, 4);
+    chain.flush();
+    CHECK(digitRegister(5) == LKM1638Board::getDigitSegments(6));
+    CHECK(digitRegister(6) == LKM1638Board::getDigitSegments(5));
+    for (uint8_t pos = 7; pos <= 9; pos++) {
+        CHECK(digitRegister(pos) == SEGMENTS_OFF);
+    }
+
+    // Same as LKM1638Board::print()
+    boards[0].setPrintPos(0);
+    boards[0].print((long)-123, DEC, 4);
+    boards[0].print((long)5, DEC, 3);
+    boards[0].flush();
+    CHECK(digitRegister(3) == SEGMENTS_OFF);
+}
+
+static void testButtons()
+{
+    uint8_t buttons[2];
+    TM1638SimStats stats0;
+    TM1638SimStats stats1;
+
+    sim0.resetStats();
+    sim1.resetStats();
+    sim0.setKeys(0x00000001UL);
+    sim1.setKeys(0x00000010UL);
+
+    // One key-scan per board
+    chain.getButtons(buttons);
+    CHECK(buttons[0] == 0x80);
+    CHECK(buttons[1] == 0x08);
+    sim0.getStats(&stats0);
+    sim1.getStats(&stats1);
+    CHECK(stats0.keyScans == 1);
+    CHECK(stats1.keyScans == 1);
+}
+
+static void testMixed()
+{
+    mixedChain.begin();
+    CHECK(mixedChain.getNumDigits() == 12);
+
+    // Value across the 4-digit board and the 8-digit board
+    mixedChain.setPrintPos(0);
+    mixedChain.print(123456UL);
+    mixedChain.setColorLED(3, LedRed);
+    mixedChain.setColorLED(4, LedGreen);
+    mixedChain.flush();
+    CHECK(simSmall.getRegister(6) == LKM1638Board::getDigitSegments(6));
+    CHECK(simSmall.getRegister(0) == LKM1638Board::getDigitSegments(3));
+    CHECK(simSmall.getRegister(1) == LedRed);
+    CHECK(simLarge.getRegister(LKM1638_DIGIT_ADDRESS(0)) == LKM1638Board::getDigitSegments(2));
+    CHECK(simLarge.getRegister(LKM1638_DIGIT_ADDRESS(1)) == LKM1638Board::getDigitSegments(1));
+    CHECK(simLarge.getRegister(LKM1638_LED_ADDRESS(0)) == LedGreen);
+
+    // Registers of the missing digits are not written
+    for (uint8_t address = 8; address < NUM_REGISTERS; address++) {
+        CHECK(simSmall.getRegister(address) == 0);
+    }
+}
+
+int main()
+{
+    chain.begin();
+
+    testSigned();
+    testButtons();
+    testMixed();
+
+    return hostResult("test_chain");
+}
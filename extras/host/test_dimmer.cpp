@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file test_dimmer.cpp
+ * \brief LKM1638Dimmer on a simulated TM1638: sub-frames and end()
+ */
+
+#include <ErriezLKM1638Dimmer.h>
+
+#include "HostTest.h"
+#include "TM1638Sim.h"
+
+static TM1638Sim sim(2, 3, 4);
+static LKM1638Board lkm1638(2, 3, 4);
+static LKM1638Dimmer dimmer(lkm1638);
+
+static void subframe()
+{
+    hostAdvanceMicros(DIMMER_SUBFRAME_US);
+    CHECK(dimmer.poll());
+}
+
+static void testSubframes()
+{
+    uint8_t on = 0;
+
+    lkm1638.setPrintPos(0);
+    lkm1638.print(12345678UL);
+    dimmer.setDigitLevel(0, 1);
+    dimmer.begin();
+
+    // The dimmer displays all changes, nothing is left to flush
+    subframe();
+    CHECK(!lkm1638.isFlushing());
+
+    // Digit 0 on in one of DIMMER_SUBFRAMES sub-frames
+    for (uint8_t i = 0; i < DIMMER_SUBFRAMES; i++) {
+        subframe();
+        CHECK(!lkm1638.isFlushing());
+        CHECK(sim.getRegister(LKM1638_DIGIT_ADDRESS(1)) == LKM1638Board::getDigitSegments(7));
+        if (sim.getRegister(LKM1638_DIGIT_ADDRESS(0)) != 0) {
+            on++;
+        }
+    }
+    CHECK(on == 1);
+
+    // Changes are displayed by the next sub-frame
+    lkm1638.setColorLED(3, LedGreen);
+    CHECK(lkm1638.isFlushing());
+    subframe();
+    CHECK(!lkm1638.isFlushing());
+    CHECK(sim.getRegister(LKM1638_LED_ADDRESS(3)) == LedGreen);
+
+    // No sub-frame during an update
+    lkm1638.beginUpdate();
+    hostAdvanceMicros(DIMMER_SUBFRAME_US);
+    CHECK(!dimmer.poll());
+    lkm1638.endUpdate();
+}
+
+static void testEnd()
+{
+    TM1638SimStats stats;
+
+    sim.resetStats();
+    dimmer.end();
+
+    // One burst of 16 registers, not written again by setBuffered(false)
+    sim.getStats(&stats);
+    CHECK(stats.frames == 2);
+    CHECK(stats.bytes == 2 + NUM_REGISTERS);
+    CHECK(!lkm1638.isBuffered());
+    CHECK(!lkm1638.isFlushing());
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        CHECK(sim.getRegister(address) == lkm1638.getRegister(address));
+    }
+}
+
+int main()
+{
+    lkm1638.begin();
+
+    testSubframes();
+    testEnd();
+
+    return hostResult("test_dimmer");
+}
@@ -0,0 +1,163 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file test_frame.cpp
+ * \brief LKM1638Frame rendered with blit() compared with LKM1638Board::print()
+ */
+
+#include <ErriezLKM1638Frame.h>
+
+#include "HostTest.h"
+#include "TM1638Sim.h"
+
+static TM1638Sim simDirect(2, 3, 4);
+static TM1638Sim simBlit(5, 6, 7);
+static LKM1638Board direct(2, 3, 4);
+static LKM1638Board blitted(5, 6, 7);
+static LKM1638Frame frame;
+
+static const uint8_t radiuses[] = { BIN, OCT, DEC, HEX };
+static const long values[] = {
+    0, 1, 5, 9, 10, 42, 255, 1000, 0xABCD, 1234567, 99999999, 100000000,
+    2147483647L, -1, -5, -42, -1000, -1234567, -9999999, -10000000,
+};
+
+static unsigned long numCompared;
+static char render[80];
+
+/*!
+ * \brief Blit the frame and compare the digits of both boards
+ */
+static void compare()
+{
+    blitted.blit(frame);
+
+    numCompared++;
+    for (uint8_t pos = 0; pos < NUM_DIGITS; pos++) {
+        uint8_t address = LKM1638_DIGIT_ADDRESS(pos);
+
+        if (!CHECK(simBlit.getRegister(address) == simDirect.getRegister(address))) {
+            printf("  %s pos %u: blit 0x%02X, print 0x%02X\n", render, pos,
+                   simBlit.getRegister(address), simDirect.getRegister(address));
+            return;
+        }
+    }
+}
+
+/*!
+ * \brief Start both boards with all digits off
+ */
+static void start(uint8_t pos)
+{
+    direct.clear();
+    direct.setPrintPos(pos);
+    frame.clear();
+}
+
+static void testUnsigned()
+{
+    for (uint8_t v = 0; v < sizeof(values) / sizeof(values[0]); v++) {
+        if (values[v] < 0) {
+            continue;
+        }
+        for (uint8_t r = 0; r < sizeof(radiuses); r++) {
+            for (uint8_t pos = 0; pos < NUM_DIGITS; pos++) {
+                for (uint8_t maxDigits = 1; maxDigits <= NUM_DIGITS; maxDigits++) {
+                    for (uint8_t pad = 1; pad <= NUM_DIGITS + 1; pad++) {
+                        start(pos);
+                        snprintf(render, sizeof(render), "print(%u, %ld, %u, %u, %u)",
+                                 pos, values[v], radiuses[r], maxDigits, pad);
+                        direct.print((unsigned long)values[v], radiuses[r], maxDigits, pad);
+                        frame.print(pos, (unsigned long)values[v], radiuses[r], maxDigits, pad);
+                        compare();
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void testSigned()
+{
+    for (uint8_t v = 0; v < sizeof(values) / sizeof(values[0]); v++) {
+        for (uint8_t r = 0; r < sizeof(radiuses); r++) {
+            for (uint8_t pos = 0; pos < NUM_DIGITS; pos++) {
+                for (uint8_t maxDigits = 1; maxDigits <= NUM_DIGITS; maxDigits++) {
+                    start(pos);
+                    snprintf(render, sizeof(render), "print(%u, %ld, %u, %u)",
+                             pos, values[v], radiuses[r], maxDigits);
+                    direct.print(values[v], radiuses[r], maxDigits);
+                    frame.print(pos, values[v], radiuses[r], maxDigits);
+                    compare();
+                }
+            }
+        }
+    }
+}
+
+static void testFixed()
+{
+    static const uint8_t fracDigits[] = { 0, 1, 2, 3, 6, 7, 8, 255 };
+
+    for (uint8_t v = 0; v < sizeof(values) / sizeof(values[0]); v++) {
+        for (uint8_t f = 0; f < sizeof(fracDigits); f++) {
+            for (uint8_t pos = 0; pos < NUM_DIGITS; pos++) {
+                for (uint8_t maxDigits = 1; maxDigits <= NUM_DIGITS; maxDigits++) {
+                    start(pos);
+                    snprintf(render, sizeof(render), "printFixed(%u, %ld, %u, %u)",
+                             pos, values[v], fracDigits[f], maxDigits);
+                    direct.printFixed(values[v], fracDigits[f], maxDigits);
+                    frame.printFixed(pos, values[v], fracDigits[f], maxDigits);
+                    compare();
+                }
+            }
+        }
+    }
+}
+
+static void testPad()
+{
+    // Padding wider than maxDigits is cut off: 05, not an overflow
+    start(0);
+    frame.print(0, 5UL, DEC, 2, 3);
+    blitted.blit(frame);
+    CHECK(simBlit.getRegister(LKM1638_DIGIT_ADDRESS(0)) == LKM1638Board::getDigitSegments(5));
+    CHECK(simBlit.getRegister(LKM1638_DIGIT_ADDRESS(1)) == LKM1638Board::getDigitSegments(0));
+}
+
+int main()
+{
+    direct.begin();
+    blitted.begin();
+
+    testPad();
+    testUnsigned();
+    testSigned();
+    testFixed();
+
+    printf("test_frame: %lu renders compared\n", numCompared);
+
+    return hostResult("test_frame");
+}
@@ -0,0 +1,106 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file test_layout.cpp
+ * \brief LKM1638Layout on a simulated TM1638: decimal points and padding
+ */
+
+#include <ErriezLKM1638Layout.h>
+
+#include "HostTest.h"
+#include "TM1638Sim.h"
+
+static TM1638Sim sim(2, 3, 4);
+static LKM1638Board lkm1638(2, 3, 4);
+
+static const LKM1638Field fields[] = {
+    { 0, 4, 10, 0, 2, FIELD_SIGNED },   // Fixed point, digits 0..3
+    { 4, 2, 10, 3, 0, FIELD_DOT },      // Padding wider than the field
+    { 6, 2, 16, 0, 0, 0 },
+};
+
+static LKM1638Layout layout(lkm1638, fields, sizeof(fields) / sizeof(fields[0]));
+
+static uint8_t digitRegister(uint8_t pos)
+{
+    return sim.getRegister(LKM1638_DIGIT_ADDRESS(pos));
+}
+
+static void testDots()
+{
+    layout.set(0, 1234);
+    layout.update();
+
+    // 12.34: decimal point right of the units digit
+    CHECK(digitRegister(0) == LKM1638Board::getDigitSegments(4));
+    CHECK(digitRegister(2) == (LKM1638Board::getDigitSegments(2) | 0x80));
+
+    // The decimal point is part of the dot state of the board
+    lkm1638.dotOff(2);
+    CHECK(digitRegister(2) == LKM1638Board::getDigitSegments(2));
+
+    // Field dot on the most right digit of the field
+    CHECK(digitRegister(4) & 0x80);
+    lkm1638.setDots(0);
+    for (uint8_t pos = 0; pos < NUM_DIGITS; pos++) {
+        CHECK((digitRegister(pos) & 0x80) == 0);
+    }
+
+    // Overflow turns the dots of the field off
+    layout.setDot(1, false);
+    layout.set(0, 5);
+    layout.update();
+    CHECK(digitRegister(2) == (LKM1638Board::getDigitSegments(0) | 0x80));
+    layout.set(0, -12345);
+    layout.update();
+    for (uint8_t pos = 0; pos < 4; pos++) {
+        CHECK(digitRegister(pos) == SEGMENTS_MINUS);
+    }
+}
+
+static void testPad()
+{
+    // Padding is limited to the field width, like LKM1638Board::print()
+    layout.set(1, 5);
+    layout.update();
+    CHECK(digitRegister(4) == LKM1638Board::getDigitSegments(5));
+    CHECK(digitRegister(5) == LKM1638Board::getDigitSegments(0));
+
+    layout.set(1, 100);
+    layout.update();
+    CHECK(digitRegister(4) == SEGMENTS_MINUS);
+    CHECK(digitRegister(5) == SEGMENTS_MINUS);
+}
+
+int main()
+{
+    lkm1638.begin();
+    CHECK(layout.begin());
+
+    testDots();
+    testPad();
+
+    return hostResult("test_layout");
+}
@@ -0,0 +1,131 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file test_meter.cpp
+ * \brief LKM1638Meter on a simulated TM1638: bar in a window of digits
+ */
+
+#include <stdlib.h>
+#include <string>
+
+#include <ErriezLKM1638Meter.h>
+
+#include "HostTest.h"
+#include "TM1638Sim.h"
+
+#define METER_LEFT      0b00110000 //!< Left level of a digit
+#define METER_RIGHT     0b00000110 //!< Right level of a digit
+
+static TM1638Sim sim(2, 3, 4);
+static LKM1638Board lkm1638(2, 3, 4);
+
+static uint8_t digitRegister(uint8_t pos)
+{
+    return sim.getRegister(LKM1638_DIGIT_ADDRESS(pos));
+}
+
+/*!
+ * \brief Highest register address written since the transcript was cleared
+ */
+static uint8_t lastWrittenAddress()
+{
+    std::string transcript = sim.getTranscript();
+    size_t start = 0;
+    uint8_t last = 0;
+
+    while ((start = transcript.find("W C", start)) != std::string::npos) {
+        size_t end = transcript.find('\n', start);
+        std::string line = transcript.substr(start, end - start);
+        uint8_t address = (uint8_t)(strtoul(line.c_str() + 2, NULL, 16) & 0x0F);
+
+        // Address Byte and one data Byte of 3 characters per register
+        address = (uint8_t)(address + ((line.size() - 4) / 3) - 1);
+        if (address > last) {
+            last = address;
+        }
+        start = end;
+    }
+
+    return last;
+}
+
+static void testFullBoard()
+{
+    LKM1638Meter meter(lkm1638, MeterSegments);
+
+    CHECK(meter.getNumLevels() == 2 * NUM_DIGITS);
+
+    // Level 3 from the most left digit
+    meter.set(3);
+    CHECK(digitRegister(NUM_DIGITS - 1) == (METER_LEFT | METER_RIGHT));
+    CHECK(digitRegister(NUM_DIGITS - 2) == METER_LEFT);
+    CHECK(digitRegister(0) == SEGMENTS_OFF);
+}
+
+static void testWindow()
+{
+    LKM1638Meter meter(lkm1638, MeterSegments);
+
+    // Value in the 4 right digits, bar in the 4 left digits
+    lkm1638.clear();
+    lkm1638.setPrintPos(0);
+    lkm1638.print(1234UL);
+    meter.setWindow(4, 4);
+    CHECK(meter.getNumLevels() == 8);
+
+    sim.clearTranscript();
+    meter.set(8);
+    for (uint8_t pos = 4; pos < 8; pos++) {
+        CHECK(digitRegister(pos) == (METER_LEFT | METER_RIGHT));
+    }
+
+    // Only the window is written, the value is not changed
+    CHECK(lastWrittenAddress() < LKM1638_DIGIT_ADDRESS(3));
+    CHECK(digitRegister(0) == LKM1638Board::getDigitSegments(4));
+    CHECK(digitRegister(3) == LKM1638Board::getDigitSegments(1));
+
+    // Default range follows the window
+    meter.set(1);
+    CHECK(digitRegister(7) == METER_LEFT);
+    CHECK(digitRegister(6) == SEGMENTS_OFF);
+    CHECK(digitRegister(0) == LKM1638Board::getDigitSegments(4));
+
+    // Window clipped at the most left digit, ignored for the LED's
+    meter.setWindow(6, 4);
+    CHECK(meter.getNumLevels() == 4);
+    LKM1638Meter ledMeter(lkm1638);
+    ledMeter.setWindow(0, 2);
+    CHECK(ledMeter.getNumLevels() == NUM_COLOR_LEDS);
+}
+
+int main()
+{
+    lkm1638.begin();
+
+    testFullBoard();
+    testWindow();
+
+    return hostResult("test_meter");
+}
@@ -0,0 +1,124 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file test_planner.cpp
+ * \brief LKM1638Board::planWrites() against brute force for all 65536 masks
+ */
+
+#include <ErriezLKM1638Board.h>
+
+#include "HostTest.h"
+
+//! Cost models: Byte cost, STB frame cost
+static const uint8_t costModels[][2] = {
+    { 1, 0 }, { 1, 1 }, { 1, 3 }, { 2, 1 }, { 1, 10 }, { 3, 0 },
+};
+
+/*!
+ * \brief Get number of writes of a plan
+ * \param plan Bit mask, every block of consecutive bits is one write
+ * \return Number of writes
+ */
+static uint8_t getNumWrites(uint16_t plan)
+{
+    uint8_t numWrites = 0;
+
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        if ((plan & (1U << address)) && ((address == 0) || !(plan & (1U << (address - 1))))) {
+            numWrites++;
+        }
+    }
+
+    return numWrites;
+}
+
+/*!
+ * \brief Check the plan of one mask against all groupings of its runs
+ * \param mask Bit mask of changed registers
+ * \param byteCost Cost of one Byte
+ * \param frameCost Cost of one STB frame
+ */
+static void checkMask(uint16_t mask, uint8_t byteCost, uint8_t frameCost)
+{
+    uint8_t runFirst[NUM_REGISTERS / 2];
+    uint8_t runLast[NUM_REGISTERS / 2];
+    uint8_t numRuns = 0;
+    uint16_t bestCost = 0;
+    uint8_t bestWrites = 0;
+    uint16_t plan;
+    uint16_t cost;
+    uint8_t numWrites;
+
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        if (mask & (1U << address)) {
+            if ((numRuns == 0) || (runLast[numRuns - 1] != (address - 1))) {
+                runFirst[numRuns++] = address;
+            }
+            runLast[numRuns - 1] = address;
+        }
+    }
+
+    // Every gap between two runs is written by a burst or not
+    for (uint16_t bridges = 0; (numRuns > 0) && (bridges < (1U << (numRuns - 1))); bridges++) {
+        uint16_t groups = mask;
+
+        for (uint8_t i = 0; i < (numRuns - 1); i++) {
+            if (bridges & (1U << i)) {
+                for (uint8_t address = (uint8_t)(runLast[i] + 1); address < runFirst[i + 1]; address++) {
+                    groups |= (uint16_t)(1U << address);
+                }
+            }
+        }
+
+        cost = LKM1638Board::getPlanCost(groups, byteCost, frameCost);
+        numWrites = getNumWrites(groups);
+        if ((bridges == 0) || (cost < bestCost) ||
+            ((cost == bestCost) && (numWrites < bestWrites))) {
+            bestCost = cost;
+            bestWrites = numWrites;
+        }
+    }
+
+    plan = LKM1638Board::planWrites(mask, byteCost, frameCost);
+    cost = LKM1638Board::getPlanCost(plan, byteCost, frameCost);
+    numWrites = getNumWrites(plan);
+
+    // All changed registers, cheapest cost, fewest writes on a tie
+    if (!CHECK(((plan & mask) == mask) && (cost == bestCost) && (numWrites == bestWrites))) {
+        printf("  mask 0x%04X cost %u/%u: plan 0x%04X cost %u writes %u, best %u writes %u\n",
+               mask, byteCost, frameCost, plan, cost, numWrites, bestCost, bestWrites);
+    }
+}
+
+int main()
+{
+    for (uint8_t m = 0; m < sizeof(costModels) / sizeof(costModels[0]); m++) {
+        for (uint32_t mask = 0; mask <= 0xFFFF; mask++) {
+            checkMask((uint16_t)mask, costModels[m][0], costModels[m][1]);
+        }
+    }
+
+    return hostResult("test_planner");
+}
@@ -0,0 +1,401 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file test_print.cpp
+ * \brief Differential test of the print functions against a reference model
+ * \details
+ *      Every print() overload and print<RADIUS, MAX_DIGITS, PAD>() of
+ *      LKM1638Board runs next to the same call of LKM1638Ref, the first
+ *      release of the print functions. The LED digit images and the display
+ *      registers of both simulated boards must be equal, and the board may
+ *      not use more STB frames than the reference, which writes every digit
+ *      separately. 8-bit values are tested exhaustively, 16 and 32-bit values
+ *      with edge cases and random values.
+ *
+ *      Usage: test_print [full]. make check runs the default set in positions
+ *      0, 3 and 6. "full" uses all positions and adds all 16-bit values, more
+ *      radiuses and random 32-bit values.
+ */
+
+#include <chrono>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ErriezLKM1638Board.h>
+#include "reference/ErriezLKM1638Ref.h"
+
+#include "HostTest.h"
+#include "TM1638Sim.h"
+
+/*!
+ * \brief LKM1638Board with access to the LED digits
+ */
+class Board : public LKM1638Board
+{
+public:
+    Board(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin) :
+            LKM1638Board(clkPin, dioPin, stbPin) { }
+    const uint8_t *getLeds() { return _leds; }
+    uint8_t getDots() { return _dots; }
+};
+
+/*!
+ * \brief LKM1638Ref with access to the LED digits
+ */
+class Ref : public LKM1638Ref
+{
+public:
+    Ref(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin) :
+            LKM1638Ref(clkPin, dioPin, stbPin) { }
+    const uint8_t *getLeds() { return _leds; }
+    uint8_t getDots() { return _dots; }
+};
+
+static TM1638Sim simBoard(2, 3, 4);
+static TM1638Sim simRef(5, 6, 7);
+static Board board(2, 3, 4);
+static Ref ref(5, 6, 7);
+
+static bool full;
+static unsigned long numCases;
+
+//! Edge cases of 16 and 32-bit values
+static const uint32_t edgeValues[] = {
+    0, 1, 7, 8, 9, 10, 15, 16, 99, 100, 127, 128, 255, 256, 999, 1000,
+    4095, 4096, 9999, 10000, 32767, 32768, 65535, 65536, 99999, 100000,
+    1048575, 1048576, 9999999, 10000000, 16777215, 16777216, 99999999,
+    100000000, 268435455, 268435456, 2147483647UL, 2147483648UL,
+    4294967295UL,
+};
+
+/*!
+ * \brief Count STB frames of a transcript
+ * \param transcript Transcript, one frame per line
+ * \return Number of frames
+ */
+static size_t countFrames(const std::string &transcript)
+{
+    size_t numFrames = 0;
+
+    for (size_t i = 0; i < transcript.size(); i++) {
+        if (transcript[i] == '\n') {
+            numFrames++;
+        }
+    }
+
+    return numFrames;
+}
+
+/*!
+ * \brief Compare LED digits, display registers and frames of the last print
+ * \param name Print function
+ * \param value Printed value
+ * \param radius Radius
+ * \param maxDigits Maximum number of digits
+ * \param pad Padding
+ */
+static void compare(const char *name, long value, uint8_t radius, uint8_t maxDigits,
+                    uint8_t pad)
+{
+    numCases++;
+
+    if (!CHECK((memcmp(board.getLeds(), ref.getLeds(), NUM_DIGITS) == 0) &&
+               (board.getDots() == ref.getDots()) &&
+               (memcmp(simBoard.getRegisters(), simRef.getRegisters(), NUM_REGISTERS) == 0) &&
+               (countFrames(simBoard.getTranscript()) <=
+                countFrames(simRef.getTranscript()))) &&
+        (hostFailures <= 20)) {
+        printf("  %s(%ld, %u, %u, %u) at pos %u\n    board: %s    ref:   %s",
+               name, value, radius, maxDigits, pad, board.getPrintPos(),
+               simBoard.getTranscript().c_str(), simRef.getTranscript().c_str());
+    }
+
+    simBoard.clearTranscript();
+    simRef.clearTranscript();
+}
+
+//! Print the same value on both boards and compare
+#define COMPARE(name, value, radius, maxDigits, pad, boardCall, refCall) \
+    do {                                                                 \
+        boardCall;                                                       \
+        refCall;                                                         \
+        compare(name, (long)(value), radius, maxDigits, pad);            \
+    } while (0)
+
+/*!
+ * \brief Set print position of both boards
+ * \param pos Position 0..7
+ */
+static void setPrintPos(uint8_t pos)
+{
+    board.setPrintPos(pos);
+    ref.setPrintPos(pos);
+}
+
+/*!
+ * \brief Compare print() overloads with radius and maxDigits of one value
+ * \param v Value, truncated to the width of every type
+ * \param radius Radius
+ * \param maxDigits Maximum number of digits
+ * \param pad Padding of the unsigned overloads
+ */
+static void compareOverloads(uint32_t v, uint8_t radius, uint8_t maxDigits, uint8_t pad)
+{
+    COMPARE("print(uint8_t)", (uint8_t)v, radius, maxDigits, pad,
+            board.print((uint8_t)v, radius, maxDigits, pad),
+            ref.print((uint8_t)v, radius, maxDigits, pad));
+    COMPARE("print(int8_t)", (int8_t)v, radius, maxDigits, 0,
+            board.print((int8_t)v, radius, maxDigits),
+            ref.print((int8_t)v, radius, maxDigits));
+    COMPARE("print(uint16_t)", (uint16_t)v, radius, maxDigits, pad,
+            board.print((uint16_t)v, radius, maxDigits, pad),
+            ref.print((uint16_t)v, radius, maxDigits, pad));
+    COMPARE("print(int16_t)", (int16_t)v, radius, maxDigits, 0,
+            board.print((int16_t)v, radius, maxDigits),
+            ref.print((int16_t)v, radius, maxDigits));
+    COMPARE("print(unsigned long)", v, radius, maxDigits, pad,
+            board.print((unsigned long)v, radius, maxDigits, pad),
+            ref.print((unsigned long)v, radius, maxDigits, pad));
+    COMPARE("print(long)", (int32_t)v, radius, maxDigits, 0,
+            board.print((long)(int32_t)v, radius, maxDigits),
+            ref.print((long)(int32_t)v, radius, maxDigits));
+}
+
+/*!
+ * \brief Compare print() overloads with default arguments of one value
+ * \param v Value, truncated to the width of every type
+ * \param radius Radius of the overloads with two arguments
+ */
+static void compareDefaults(uint32_t v, uint8_t radius)
+{
+    COMPARE("print(uint8_t)", (uint8_t)v, DEC, 0, 0,
+            board.print((uint8_t)v), ref.print((uint8_t)v));
+    COMPARE("print(uint8_t)", (uint8_t)v, radius, 0, 0,
+            board.print((uint8_t)v, radius), ref.print((uint8_t)v, radius));
+    COMPARE("print(uint8_t)", (uint8_t)v, radius, 3, 0,
+            board.print((uint8_t)v, radius, 3), ref.print((uint8_t)v, radius, 3));
+    COMPARE("print(int8_t)", (int8_t)v, DEC, 0, 0,
+            board.print((int8_t)v), ref.print((int8_t)v));
+    COMPARE("print(int8_t)", (int8_t)v, radius, 0, 0,
+            board.print((int8_t)v, radius), ref.print((int8_t)v, radius));
+    COMPARE("print(uint16_t)", (uint16_t)v, DEC, 0, 0,
+            board.print((uint16_t)v), ref.print((uint16_t)v));
+    COMPARE("print(uint16_t)", (uint16_t)v, radius, 0, 0,
+            board.print((uint16_t)v, radius), ref.print((uint16_t)v, radius));
+    COMPARE("print(uint16_t)", (uint16_t)v, radius, 5, 0,
+            board.print((uint16_t)v, radius, 5), ref.print((uint16_t)v, radius, 5));
+    COMPARE("print(int16_t)", (int16_t)v, DEC, 0, 0,
+            board.print((int16_t)v), ref.print((int16_t)v));
+    COMPARE("print(int16_t)", (int16_t)v, radius, 0, 0,
+            board.print((int16_t)v, radius), ref.print((int16_t)v, radius));
+    COMPARE("print(unsigned long)", v, DEC, 0, 0,
+            board.print((unsigned long)v), ref.print((unsigned long)v));
+    COMPARE("print(unsigned long)", v, radius, 0, 0,
+            board.print((unsigned long)v, radius), ref.print((unsigned long)v, radius));
+    COMPARE("print(unsigned long)", v, radius, 8, 0,
+            board.print((unsigned long)v, radius, 8),
+            ref.print((unsigned long)v, radius, 8));
+    COMPARE("print(long)", (int32_t)v, DEC, 0, 0,
+            board.print((long)(int32_t)v), ref.print((long)(int32_t)v));
+    COMPARE("print(long)", (int32_t)v, radius, 0, 0,
+            board.print((long)(int32_t)v, radius), ref.print((long)(int32_t)v, radius));
+}
+
+/*!
+ * \brief Compare print<RADIUS, MAX_DIGITS, PAD>() of all value types
+ * \param v Value, truncated to the width of every type
+ */
+template <uint8_t RADIUS, uint8_t MAX_DIGITS, uint8_t PAD>
+static void compareTemplate(uint32_t v)
+{
+    COMPARE("print<uint8_t>", (uint8_t)v, RADIUS, MAX_DIGITS, PAD,
+            (board.print<RADIUS, MAX_DIGITS, PAD>((uint8_t)v)),
+            ref.print((uint8_t)v, RADIUS, MAX_DIGITS, PAD));
+    COMPARE("print<int8_t>", (int8_t)v, RADIUS, MAX_DIGITS, PAD,
+            (board.print<RADIUS, MAX_DIGITS, PAD>((int8_t)v)),
+            ref.print((int8_t)v, RADIUS, MAX_DIGITS));
+    COMPARE("print<uint16_t>", (uint16_t)v, RADIUS, MAX_DIGITS, PAD,
+            (board.print<RADIUS, MAX_DIGITS, PAD>((uint16_t)v)),
+            ref.print((uint16_t)v, RADIUS, MAX_DIGITS, PAD));
+    COMPARE("print<int16_t>", (int16_t)v, RADIUS, MAX_DIGITS, PAD,
+            (board.print<RADIUS, MAX_DIGITS, PAD>((int16_t)v)),
+            ref.print((int16_t)v, RADIUS, MAX_DIGITS));
+    COMPARE("print<uint32_t>", v, RADIUS, MAX_DIGITS, PAD,
+            (board.print<RADIUS, MAX_DIGITS, PAD>((uint32_t)v)),
+            ref.print((unsigned long)v, RADIUS, MAX_DIGITS, PAD));
+    COMPARE("print<int32_t>", (int32_t)v, RADIUS, MAX_DIGITS, PAD,
+            (board.print<RADIUS, MAX_DIGITS, PAD>((int32_t)v)),
+            ref.print((long)(int32_t)v, RADIUS, MAX_DIGITS));
+}
+
+/*!
+ * \brief Compare print<RADIUS, MAX_DIGITS, PAD>() for a set of widths
+ * \param v Value
+ */
+template <uint8_t RADIUS>
+static void compareTemplates(uint32_t v)
+{
+    compareTemplate<RADIUS, 0, 0>(v);
+    compareTemplate<RADIUS, 1, 1>(v);
+    compareTemplate<RADIUS, 2, 0>(v);
+    compareTemplate<RADIUS, 3, 3>(v);
+    compareTemplate<RADIUS, 4, 2>(v);
+    compareTemplate<RADIUS, 5, 9>(v);
+    compareTemplate<RADIUS, 8, 0>(v);
+    compareTemplate<RADIUS, 8, 8>(v);
+    compareTemplate<RADIUS, 9, 1>(v);
+}
+
+/*!
+ * \brief Compare one value with all print functions
+ * \param v Value
+ * \param radiuses Radiuses
+ * \param numRadiuses Number of radiuses
+ * \param maxWidth Largest maxDigits and pad
+ */
+static void compareValue(uint32_t v, const uint8_t *radiuses, uint8_t numRadiuses,
+                         uint8_t maxWidth)
+{
+    for (uint8_t pos = 0; pos < NUM_DIGITS; pos = (uint8_t)(pos + (full ? 1 : 3))) {
+        setPrintPos(pos);
+
+        for (uint8_t r = 0; r < numRadiuses; r++) {
+            for (uint8_t maxDigits = 0; maxDigits <= maxWidth; maxDigits++) {
+                compareOverloads(v, radiuses[r], maxDigits, (uint8_t)(v % (maxWidth + 1)));
+            }
+            compareDefaults(v, radiuses[r]);
+        }
+
+        compareTemplates<BIN>(v);
+        compareTemplates<OCT>(v);
+        compareTemplates<DEC>(v);
+        compareTemplates<HEX>(v);
+    }
+}
+
+/*!
+ * \brief Compare 8-bit values with all widths and paddings
+ * \param radiuses Radiuses
+ * \param numRadiuses Number of radiuses
+ */
+static void compare8Bit(const uint8_t *radiuses, uint8_t numRadiuses)
+{
+    // Positions 0, 3 and 6 cover a value at, and clipped by, the display edge
+    for (uint8_t pos = 0; pos < NUM_DIGITS; pos = (uint8_t)(pos + (full ? 1 : 3))) {
+        setPrintPos(pos);
+
+        for (uint16_t v = 0; v <= 0xFF; v++) {
+            for (uint8_t r = 0; r < numRadiuses; r++) {
+                for (uint8_t maxDigits = 0; maxDigits <= (NUM_DIGITS + 1); maxDigits++) {
+                    for (uint8_t pad = 0; pad <= (NUM_DIGITS + 1); pad++) {
+                        COMPARE("print(uint8_t)", v, radiuses[r], maxDigits, pad,
+                                board.print((uint8_t)v, radiuses[r], maxDigits, pad),
+                                ref.print((uint8_t)v, radiuses[r], maxDigits, pad));
+                    }
+                    COMPARE("print(int8_t)", (int8_t)v, radiuses[r], maxDigits, 0,
+                            board.print((int8_t)v, radiuses[r], maxDigits),
+                            ref.print((int8_t)v, radiuses[r], maxDigits));
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Measure formatted values per second of the digit conversion
+ */
+static void benchmarkFormat()
+{
+    typedef std::chrono::steady_clock Clock;
+    const uint32_t numValues = 4000000UL;
+    uint8_t digits[NUM_DIGITS];
+    volatile uint8_t sink;
+    Clock::time_point start;
+    double runtimeSec;
+
+    start = Clock::now();
+    for (uint32_t v = 0; v < numValues; v++) {
+        sink = LKM1638Board::formatDigits(v * 2654435761UL, DEC, digits, NUM_DIGITS);
+        sink = digits[0];
+    }
+    runtimeSec = std::chrono::duration<double>(Clock::now() - start).count();
+
+    (void)sink;
+    printf("test_print: formatDigits() %.1f M values/s\n", numValues / runtimeSec / 1e6);
+}
+
+int main(int argc, char *argv[])
+{
+    typedef std::chrono::steady_clock Clock;
+    static const uint8_t radiuses[] = { BIN, DEC, HEX };
+    static const uint8_t allRadiuses[] = { 1, BIN, 3, OCT, DEC, HEX, 17 };
+    Clock::time_point start = Clock::now();
+    double seconds;
+
+    full = ((argc > 1) && (strcmp(argv[1], "full") == 0));
+
+    board.begin();
+    ref.begin();
+    ref.clear();
+    simBoard.clearTranscript();
+    simRef.clearTranscript();
+
+    // 8-bit values: exhaustive
+    if (full) {
+        compare8Bit(allRadiuses, sizeof(allRadiuses));
+    } else {
+        compare8Bit(radiuses, sizeof(radiuses));
+    }
+
+    // 16-bit values: exhaustive in full mode, otherwise every 257th value
+    for (uint32_t v = 0; v <= 0xFFFF; v += (full ? 1 : 257)) {
+        setPrintPos((uint8_t)(v % NUM_DIGITS));
+        for (uint8_t r = 0; r < sizeof(radiuses); r++) {
+            compareOverloads(v, radiuses[r], (uint8_t)(v % (NUM_DIGITS + 2)),
+                             (uint8_t)((v / 7) % (NUM_DIGITS + 2)));
+        }
+    }
+
+    // 32-bit values: edge cases and random values in all positions
+    srand(1638);
+    for (uint8_t i = 0; i < sizeof(edgeValues) / sizeof(edgeValues[0]); i++) {
+        compareValue(edgeValues[i], full ? allRadiuses : radiuses,
+                     full ? sizeof(allRadiuses) : sizeof(radiuses), NUM_DIGITS + 1);
+        compareValue((uint32_t)0 - edgeValues[i], radiuses, sizeof(radiuses), NUM_DIGITS + 1);
+    }
+    for (uint16_t i = 0; i < (full ? 2000 : 100); i++) {
+        uint32_t v = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+
+        // Mostly values which fit on the display
+        compareValue((i & 1) ? v : (v >> (i % 32)), radiuses, sizeof(radiuses), NUM_DIGITS + 1);
+    }
+
+    seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    printf("test_print: %lu prints compared, %.0f prints/s on the simulated bus\n",
+           numCases, numCases / seconds);
+    benchmarkFormat();
+
+    return hostResult("test_print");
+}
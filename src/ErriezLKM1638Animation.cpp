@@ -0,0 +1,216 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Animation.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include "ErriezLKM1638Animation.h"
+
+/*!
+ * \brief LKM1638Animation constructor
+ * \param board LKM1638 board
+ */
+LKM1638Animation::LKM1638Animation(LKM1638Board &board) :
+        _board(board), _data(NULL), _offset(0), _numFrames(0), _frame(0),
+        _deltas(false), _loop(true), _mask(0xFFFF),
+        _intervalMs(ANIMATION_INTERVAL_MS), _lastFrameMs(0), _running(false)
+{
+}
+
+//------------------------------------------------------------------------------
+// Configuration
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set frame interval
+ * \param intervalMs Time in ms between two frames
+ */
+void LKM1638Animation::setInterval(uint16_t intervalMs)
+{
+    _intervalMs = intervalMs;
+}
+
+/*!
+ * \brief Restart or stop after the last frame
+ * \param loop true: Restart with the first frame (default), false: Stop
+ */
+void LKM1638Animation::setLoop(bool loop)
+{
+    _loop = loop;
+}
+
+/*!
+ * \brief Set registers written by register images
+ * \details
+ *      Registers outside the mask are not changed, for example 0x5555 to
+ *      animate only the digits and 0xAAAA to animate only the color LED's.
+ * \param mask Bit mask of registers, bit 0 is address 0x00
+ */
+void LKM1638Animation::setMask(uint16_t mask)
+{
+    _mask = mask;
+}
+
+//------------------------------------------------------------------------------
+// Start and stop animation
+//------------------------------------------------------------------------------
+/*!
+ * \brief Play 16 Byte register images
+ * \details
+ *      The first frame is displayed immediately.
+ * \param frames Register images in flash, numFrames * 16 Bytes
+ * \param numFrames Number of frames
+ */
+void LKM1638Animation::playFrames(const uint8_t *frames, uint8_t numFrames)
+{
+    start(frames, numFrames, false);
+}
+
+/*!
+ * \brief Play delta records
+ * \details
+ *      The first frame is displayed immediately. When looping, the first
+ *      record is applied after the last frame.
+ * \param deltas Delta records in flash
+ * \param numFrames Number of frames
+ */
+void LKM1638Animation::playDeltas(const uint8_t *deltas, uint8_t numFrames)
+{
+    start(deltas, numFrames, true);
+}
+
+/*!
+ * \brief Stop animation, the display is not changed
+ */
+void LKM1638Animation::stop()
+{
+    _running = false;
+}
+
+/*!
+ * \brief Check if the animation is playing
+ * \retval true Playing
+ * \retval false Stopped
+ */
+bool LKM1638Animation::isRunning()
+{
+    return _running;
+}
+
+//------------------------------------------------------------------------------
+// Play animation
+//------------------------------------------------------------------------------
+/*!
+ * \brief Display the next frame when the frame interval elapsed
+ * \details
+ *      Call this function from loop() as often as possible. Frames are
+ *      scheduled at a fixed rate. When poll() was called too late, the
+ *      schedule restarts at the current time.
+ * \retval true Frame displayed
+ * \retval false No change
+ */
+bool LKM1638Animation::poll()
+{
+    unsigned long now = millis();
+
+    if (!_running || ((now - _lastFrameMs) < _intervalMs)) {
+        return false;
+    }
+
+    if ((now - _lastFrameMs) < (2UL * _intervalMs)) {
+        _lastFrameMs += _intervalMs;
+    } else {
+        _lastFrameMs = now;
+    }
+
+    showFrame();
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Private functions
+//------------------------------------------------------------------------------
+/*!
+ * \brief Start animation
+ * \param data Frames in flash
+ * \param numFrames Number of frames
+ * \param deltas true: Delta records, false: Register images
+ */
+void LKM1638Animation::start(const uint8_t *data, uint8_t numFrames, bool deltas)
+{
+    _data = data;
+    _numFrames = numFrames;
+    _deltas = deltas;
+    _frame = 0;
+    _offset = 0;
+    _running = (numFrames > 0);
+    _lastFrameMs = millis();
+
+    if (_running) {
+        showFrame();
+    }
+}
+
+/*!
+ * \brief Display next frame
+ */
+void LKM1638Animation::showFrame()
+{
+    uint8_t regs[NUM_REGISTERS];
+    uint16_t mask = 0;
+
+    if (_deltas) {
+        uint8_t count = pgm_read_byte(&_data[_offset++]);
+
+        while (count--) {
+            uint8_t address = pgm_read_byte(&_data[_offset++]);
+            uint8_t data = pgm_read_byte(&_data[_offset++]);
+
+            if (address < NUM_REGISTERS) {
+                regs[address] = data;
+                mask |= (uint16_t)(1U << address);
+            }
+        }
+    } else {
+        for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+            regs[address] = pgm_read_byte(&_data[_offset++]);
+        }
+        mask = _mask;
+    }
+
+    // Write registers which changed
+    _board.setRegisters(regs, mask);
+
+    if (++_frame >= _numFrames) {
+        _frame = 0;
+        _offset = 0;
+        _running = _loop;
+    }
+}
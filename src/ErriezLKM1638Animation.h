@@ -0,0 +1,91 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Animation.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_ANIMATION_H_
+#define ERRIEZ_LKM1638_ANIMATION_H_
+
+#include "ErriezLKM1638Platform.h"
+
+#include "ErriezLKM1638Board.h"
+
+#define ANIMATION_INTERVAL_MS   100 //!< Default frame interval
+
+/*!
+ * \brief LKM1638Animation class
+ * \details
+ *      Plays frames from flash without blocking. A frame is a 16 Byte TM1638
+ *      register image, or a delta record with only the registers which
+ *      change:
+ *
+ *          count, address0, data0, address1, data1, ...
+ *
+ *      Only registers which differ from the previous frame are written.
+ */
+class LKM1638Animation
+{
+public:
+    // Constructor
+    explicit LKM1638Animation(LKM1638Board &board);
+
+    // Configuration
+    void setInterval(uint16_t intervalMs);
+    void setLoop(bool loop);
+    void setMask(uint16_t mask);
+
+    // Start and stop animation
+    void playFrames(const uint8_t *frames, uint8_t numFrames);
+    void playDeltas(const uint8_t *deltas, uint8_t numFrames);
+    void stop();
+    bool isRunning();
+
+    // Play animation
+    bool poll();
+
+protected:
+    LKM1638Board &_board;       //!< Board
+    const uint8_t *_data;       //!< Frames in flash
+    uint16_t _offset;           //!< Offset of the next frame
+    uint8_t _numFrames;         //!< Number of frames
+    uint8_t _frame;             //!< Next frame
+    bool _deltas;               //!< Frames are delta records
+    bool _loop;                 //!< Restart after the last frame
+    uint16_t _mask;             //!< Registers written by register images
+    uint16_t _intervalMs;       //!< Frame interval
+    unsigned long _lastFrameMs; //!< Time of the last frame
+    bool _running;              //!< Playing
+
+    void start(const uint8_t *data, uint8_t numFrames, bool deltas);
+    void showFrame();
+};
+
+#endif // ERRIEZ_LKM1638_ANIMATION_H_
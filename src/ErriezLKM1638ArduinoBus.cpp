@@ -0,0 +1,141 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638ArduinoBus.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include "ErriezLKM1638ArduinoBus.h"
+
+#if LKM1638_ARDUINO
+
+/*!
+ * \brief LKM1638ArduinoBus constructor
+ * \param clkPin Clock pin
+ * \param dioPin Data pin (bi-directional)
+ * \param stbPin Strobe pin (low is enable)
+ */
+LKM1638ArduinoBus::LKM1638ArduinoBus(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin) :
+        _clkPin(clkPin), _dioPin(dioPin), _stbPin(stbPin)
+{
+}
+
+/*!
+ * \brief Initialize pins, STB and CLK high
+ */
+void LKM1638ArduinoBus::begin()
+{
+    digitalWrite(_stbPin, HIGH);
+    pinMode(_stbPin, OUTPUT);
+    digitalWrite(_clkPin, HIGH);
+    pinMode(_clkPin, OUTPUT);
+    pinMode(_dioPin, OUTPUT);
+}
+
+/*!
+ * \brief Release pins
+ */
+void LKM1638ArduinoBus::end()
+{
+    pinMode(_stbPin, INPUT);
+    pinMode(_clkPin, INPUT);
+    pinMode(_dioPin, INPUT);
+}
+
+/*!
+ * \brief Write one STB frame
+ * \param data Command and data Bytes
+ * \param len Number of Bytes
+ */
+void LKM1638ArduinoBus::write(const uint8_t *data, uint8_t len)
+{
+    digitalWrite(_stbPin, LOW);
+    for (uint8_t i = 0; i < len; i++) {
+        writeByte(data[i]);
+    }
+    digitalWrite(_stbPin, HIGH);
+}
+
+/*!
+ * \brief Write a command and read Bytes in one STB frame
+ * \param command Command
+ * \param data Buffer for the read Bytes
+ * \param len Number of Bytes to read
+ */
+void LKM1638ArduinoBus::read(uint8_t command, uint8_t *data, uint8_t len)
+{
+    digitalWrite(_stbPin, LOW);
+    writeByte(command);
+    pinMode(_dioPin, INPUT);
+    delayMicroseconds(1);
+    for (uint8_t i = 0; i < len; i++) {
+        data[i] = readByte();
+    }
+    pinMode(_dioPin, OUTPUT);
+    digitalWrite(_stbPin, HIGH);
+}
+
+/*!
+ * \brief Write Byte, LSB first, data latched on rising clock edge
+ * \param data Byte
+ */
+void LKM1638ArduinoBus::writeByte(uint8_t data)
+{
+    for (uint8_t i = 0; i < 8; i++) {
+        digitalWrite(_clkPin, LOW);
+        digitalWrite(_dioPin, (data & 0x01) ? HIGH : LOW);
+        delayMicroseconds(1);
+        digitalWrite(_clkPin, HIGH);
+        delayMicroseconds(1);
+        data >>= 1;
+    }
+}
+
+/*!
+ * \brief Read Byte, LSB first, data valid after falling clock edge
+ * \return Byte
+ */
+uint8_t LKM1638ArduinoBus::readByte()
+{
+    uint8_t data = 0;
+
+    for (uint8_t i = 0; i < 8; i++) {
+        digitalWrite(_clkPin, LOW);
+        delayMicroseconds(1);
+        digitalWrite(_clkPin, HIGH);
+        if (digitalRead(_dioPin) == HIGH) {
+            data |= (uint8_t)(1 << i);
+        }
+        delayMicroseconds(1);
+    }
+
+    return data;
+}
+
+#endif // LKM1638_ARDUINO
@@ -0,0 +1,71 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638ArduinoBus.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_ARDUINO_BUS_H_
+#define ERRIEZ_LKM1638_ARDUINO_BUS_H_
+
+#include "ErriezLKM1638Platform.h"
+
+#include "ErriezLKM1638Bus.h"
+
+#if LKM1638_ARDUINO
+
+/*!
+ * \brief LKM1638ArduinoBus class
+ * \details
+ *      TM1638 bus on three Arduino pins with digitalWrite() and digitalRead().
+ */
+class LKM1638ArduinoBus : public LKM1638Bus
+{
+public:
+    // Constructor with 3 pins
+    LKM1638ArduinoBus(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin);
+
+    // LKM1638Bus interface
+    virtual void begin();
+    virtual void end();
+    virtual void write(const uint8_t *data, uint8_t len);
+    virtual void read(uint8_t command, uint8_t *data, uint8_t len);
+
+protected:
+    uint8_t _clkPin;            //!< Clock pin
+    uint8_t _dioPin;            //!< Data pin (bi-directional)
+    uint8_t _stbPin;            //!< Strobe pin (low is enable)
+
+    void writeByte(uint8_t data);
+    uint8_t readByte();
+};
+
+#endif // LKM1638_ARDUINO
+
+#endif // ERRIEZ_LKM1638_ARDUINO_BUS_H_
@@ -31,13 +31,8 @@
  *   Documentation:  https://erriez.github.io/ErriezLKM1638
  */
 
-#if defined(__AVR__)
-#include <avr/pgmspace.h>
-#else
-#include <pgmspace.h>
-#endif
-
 #include "ErriezLKM1638Board.h"
+#include "ErriezLKM1638Frame.h"
 
 /* 7-segment bits:
    - 0 -
@@ -71,16 +66,227 @@ static const PROGMEM uint8_t SEGMENT_DATA[] = {
         0b01110001, /* F */
 };
 
+// 7-segment ASCII characters 0x20..0x7F
+static const PROGMEM uint8_t ASCII_SEGMENT_DATA[] = {
+        0b00000000, /* (space) */
+        0b10000110, /* ! */
+        0b00100010, /* " */
+        0b01111110, /* # */
+        0b01101101, /* $ */
+        0b11010010, /* % */
+        0b01000110, /* & */
+        0b00100000, /* ' */
+        0b00101001, /* ( */
+        0b00001011, /* ) */
+        0b00100001, /* * */
+        0b01110000, /* + */
+        0b00010000, /* , */
+        0b01000000, /* - */
+        0b10000000, /* . */
+        0b01010010, /* / */
+        0b00111111, /* 0 */
+        0b00000110, /* 1 */
+        0b01011011, /* 2 */
+        0b01001111, /* 3 */
+        0b01100110, /* 4 */
+        0b01101101, /* 5 */
+        0b01111101, /* 6 */
+        0b00000111, /* 7 */
+        0b01111111, /* 8 */
+        0b01101111, /* 9 */
+        0b00001001, /* : */
+        0b00001101, /* ; */
+        0b01100001, /* < */
+        0b01001000, /* = */
+        0b01000011, /* > */
+        0b11010011, /* ? */
+        0b01011111, /* @ */
+        0b01110111, /* A */
+        0b01111100, /* B */
+        0b00111001, /* C */
+        0b01011110, /* D */
+        0b01111001, /* E */
+        0b01110001, /* F */
+        0b00111101, /* G */
+        0b01110110, /* H */
+        0b00110000, /* I */
+        0b00011110, /* J */
+        0b01110101, /* K */
+        0b00111000, /* L */
+        0b00010101, /* M */
+        0b00110111, /* N */
+        0b00111111, /* O */
+        0b01110011, /* P */
+        0b01101011, /* Q */
+        0b00110011, /* R */
+        0b01101101, /* S */
+        0b01111000, /* T */
+        0b00111110, /* U */
+        0b00111110, /* V */
+        0b00101010, /* W */
+        0b01110110, /* X */
+        0b01101110, /* Y */
+        0b01011011, /* Z */
+        0b00111001, /* [ */
+        0b01100100, /* backslash */
+        0b00001111, /* ] */
+        0b00100011, /* ^ */
+        0b00001000, /* _ */
+        0b00000010, /* ` */
+        0b01011111, /* a */
+        0b01111100, /* b */
+        0b01011000, /* c */
+        0b01011110, /* d */
+        0b01111011, /* e */
+        0b01110001, /* f */
+        0b01101111, /* g */
+        0b01110100, /* h */
+        0b00010000, /* i */
+        0b00001100, /* j */
+        0b01110101, /* k */
+        0b00110000, /* l */
+        0b00010100, /* m */
+        0b01010100, /* n */
+        0b01011100, /* o */
+        0b01110011, /* p */
+        0b01100111, /* q */
+        0b01010000, /* r */
+        0b01101101, /* s */
+        0b01111000, /* t */
+        0b00011100, /* u */
+        0b00011100, /* v */
+        0b00010100, /* w */
+        0b01110110, /* x */
+        0b01101110, /* y */
+        0b01011011, /* z */
+        0b01000110, /* { */
+        0b00110000, /* | */
+        0b01110000, /* } */
+        0b00000001, /* ~ */
+        0b00000000, /* (del) */
+};
+
+// Powers of ten for decimal conversion
+static const PROGMEM uint32_t POWERS_OF_10[] = {
+        1UL,
+        10UL,
+        100UL,
+        1000UL,
+        10000UL,
+        100000UL,
+        1000000UL,
+        10000000UL,
+        100000000UL,
+        1000000000UL,
+};
+
+// Bit reversed nibbles for swapBits()
+static const PROGMEM uint8_t REVERSED_NIBBLES[] = {
+        0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E,
+        0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F,
+};
+
+#if LKM1638_TM1638
 /*!
  * \brief LKM1638 constructor
+ * \details
+ *      Called by the inline constructors in the header. The config tag is
+ *      named after the build flags, see LKM1638_CONFIG.
  * \param clkPin Clock pin
  * \param dioPin Data pin (bi-directional)
  * \param stbPin Strobe pin (low is enable)
+ * \param numDigits Number of digits 1..LKM1638_MAX_DIGITS
+ * \param numColorLeds Number of dual color LED's 0..LKM1638_MAX_COLOR_LEDS
+ */
+LKM1638Board::LKM1638Board(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin,
+                           uint8_t numDigits, uint8_t numColorLeds, LKM1638_CONFIG) :
+        TM1638(clkPin, dioPin, stbPin),
+#else
+/*!
+ * \brief LKM1638 constructor without the TM1638 library
+ * \details
+ *      Called by the inline constructors of LKM1638BusBoard. The config tag is
+ *      named after the build flags, see LKM1638_CONFIG.
+ * \param numDigits Number of digits 1..LKM1638_MAX_DIGITS
+ * \param numColorLeds Number of dual color LED's 0..LKM1638_MAX_COLOR_LEDS
+ */
+LKM1638Board::LKM1638Board(uint8_t numDigits, uint8_t numColorLeds, LKM1638_CONFIG) :
+#endif
+        _numDigits((numDigits < LKM1638_MAX_DIGITS) ? numDigits : LKM1638_MAX_DIGITS),
+        _numColorLeds((numColorLeds < LKM1638_MAX_COLOR_LEDS) ?
+                      numColorLeds : LKM1638_MAX_COLOR_LEDS),
+        _pos(0), _dots(0), _dirty(0), _buffered(false), _pollAddress(0), _flushBudgetUs(FLUSH_BUDGET_US),
+        _byteUs(0), _byteCost(WRITE_BYTE_COST), _frameCost(WRITE_FRAME_COST),
+        _updateDepth(0), _updateBuffered(false), _updateDirty(0)
+{
+    memset(_leds, 0, sizeof(_leds));
+    memset(_regs, 0, NUM_REGISTERS);
+    memset(_updateRegs, 0, NUM_REGISTERS);
+
+#if LKM1638_STATS
+    memset(_busRegs, 0, NUM_REGISTERS);
+#endif
+    resetStats();
+}
+
+//------------------------------------------------------------------------------
+// Initialize
+//------------------------------------------------------------------------------
+/*!
+ * \brief Initialize TM1638 and clear the board
+ * \details
+ *      The shadow registers start with all LED's off, so the board is
+ *      cleared to the same image.
+ */
+void LKM1638Board::begin()
+{
+    beginBus();
+
+    _updateDepth = 0;
+    _updateDirty = 0;
+    _pollAddress = 0;
+    clear();
+}
+
+//------------------------------------------------------------------------------
+// Board size
+//------------------------------------------------------------------------------
+/*!
+ * \brief Get number of digits
+ * \return Number of digits of this board
+ */
+uint8_t LKM1638Board::getNumDigits()
+{
+    return _numDigits;
+}
+
+/*!
+ * \brief Get number of dual color LED's
+ * \return Number of dual color LED's of this board
+ */
+uint8_t LKM1638Board::getNumColorLEDs()
+{
+    return _numColorLeds;
+}
+
+/*!
+ * \brief Get register address of a digit
+ * \param pos Position (0 = most right)
+ * \return Register address
+ */
+uint8_t LKM1638Board::getDigitAddress(uint8_t pos)
+{
+    return (uint8_t)(swapPos(pos) << 1);
+}
+
+/*!
+ * \brief Get register address of a dual color LED
+ * \param led LED number (0 = most right)
+ * \return Register address
  */
-LKM1638Board::LKM1638Board(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin) :
-        TM1638(clkPin, dioPin, stbPin), _pos(0), _dots(0)
+uint8_t LKM1638Board::getColorLEDAddress(uint8_t led)
 {
-    memset(_leds, 0, NUM_DIGITS);
+    return (uint8_t)(0x01 + (swapLeds(led) << 1));
 }
 
 //------------------------------------------------------------------------------
@@ -93,10 +299,10 @@ LKM1638Board::LKM1638Board(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin) :
 uint8_t LKM1638Board::getButtons()
 {
     uint32_t keys32;
-    uint8_t keys = 0;
+    uint8_t keys;
 
     /* Read 4 Byte key-scan registers */
-    keys32 = getKeys();
+    keys32 = readKeys();
 
     /* 8 buttons on the LKM1638 board are connected to K3 only
      * Sort the keys in BYTE1..BYTE4 bits 0 and 4 to a keys byte
@@ -109,9 +315,7 @@ uint8_t LKM1638Board::getButtons()
      *    |   |   |   | S8 |   |   |   | S3 | BYTE4
      */
 
-    for (uint8_t i = 0; i < 4; i++) {
-        keys |= (keys32 >> (i * 7)) & 0xFF;
-    }
+    keys = (uint8_t)(keys32 | (keys32 >> 7) | (keys32 >> 14) | (keys32 >> 21));
 
     return swapBits(keys);
 }
@@ -121,13 +325,29 @@ uint8_t LKM1638Board::getButtons()
 //------------------------------------------------------------------------------
 /*!
  * \brief Turn all LED's off
+ * \details
+ *      The board is cleared immediately, also in buffered mode. Between
+ *      beginUpdate() and endUpdate() only the shadow registers are cleared.
  */
 void LKM1638Board::clear()
 {
-    memset(_leds, 0, NUM_DIGITS);
+    memset(_leds, 0, sizeof(_leds));
+    memset(_regs, 0, NUM_REGISTERS);
     _dots = 0;
 
-    TM1638::clear();
+    if (_updateDepth) {
+        _dirty = 0xFFFF;
+        return;
+    }
+    _dirty = 0;
+
+#if LKM1638_STATS
+    unsigned long startUs = micros();
+    clearBus();
+    addDisplayStats(0x00, _regs, NUM_REGISTERS, startUs);
+#else
+    clearBus();
+#endif
 }
 
 //------------------------------------------------------------------------------
@@ -161,96 +381,889 @@ void LKM1638Board::setColorLED(uint8_t led, LedColor color)
      *     1   |   0   |  RED
      *     1   |   1   |  NOT ALLOWED
      */
-    if (led < NUM_DIGITS) {
-        writeData((uint8_t)(0x01 + (swapLeds(led) << 1)), (color & 0x03));
+    if (led < _numColorLeds) {
+        updateRegister(getColorLEDAddress(led), (uint8_t)(color & 0x03));
+    }
+}
+
+/*!
+ * \brief Set all dual color LED's with one write
+ * \details
+ *      Only LED's which changed are written. When an LED is set in both masks,
+ *      red is used.
+ * \param redLeds Byte with 8 LED's to turn red
+ * \param greenLeds Byte with 8 LED's to turn green
+ */
+void LKM1638Board::setColorLEDs(uint8_t redLeds, uint8_t greenLeds)
+{
+    uint16_t changed = 0;
+
+    greenLeds &= (uint8_t)~redLeds;
+
+    for (uint8_t led = 0; led < _numColorLeds; led++) {
+        uint8_t address = getColorLEDAddress(led);
+        uint8_t data = 0;
+
+        if (redLeds & (1 << led)) {
+            data = LedRed;
+        } else if (greenLeds & (1 << led)) {
+            data = LedGreen;
+        }
+
+        if ((_regs[address] != data) || (_dirty & (1U << address))) {
+            _regs[address] = data;
+            changed |= (uint16_t)(1U << address);
+        }
+    }
+
+    commitRegisters(changed);
+}
+
+/*!
+ * \brief Get dual color LED's with a color
+ * \param color LedOff, LedRed or LedGreen
+ * \return Byte with 8 LED's
+ */
+uint8_t LKM1638Board::getColorLEDs(LedColor color)
+{
+    uint8_t leds = 0;
+
+    for (uint8_t led = 0; led < _numColorLeds; led++) {
+        if (_regs[getColorLEDAddress(led)] == color) {
+            leds |= (uint8_t)(1 << led);
+        }
+    }
+
+    return leds;
+}
+
+/*!
+ * \brief Turn multiple color LED's on
+ * \param leds Byte with 8 LED's
+ * \param color
+ *      0: Off
+ *      1: Green
+ *      2: Red
+ */
+void LKM1638Board::colorLEDsOn(uint8_t leds, LedColor color)
+{
+    uint8_t redLeds = getColorLEDs(LedRed) & (uint8_t)~leds;
+    uint8_t greenLeds = getColorLEDs(LedGreen) & (uint8_t)~leds;
+
+    if (color & LedRed) {
+        redLeds |= leds;
+    } else if (color & LedGreen) {
+        greenLeds |= leds;
+    }
+
+    setColorLEDs(redLeds, greenLeds);
+}
+
+/*!
+ * \brief Turn multiple color LED's off
+ * \param leds Byte with 8 LED's
+ */
+void LKM1638Board::colorLEDsOff(uint8_t leds)
+{
+    colorLEDsOn(leds, LedOff);
+}
+
+//------------------------------------------------------------------------------
+// 7-segment display IO
+//------------------------------------------------------------------------------
+/*!
+ * \brief Write digit position
+ * \param pos Digit number 0 is most right digit, 7 is most left digit
+ */
+void LKM1638Board::writeDigit(uint8_t pos)
+{
+    if (pos < _numDigits) {
+        uint8_t leds = _leds[pos];
+        if (_dots & (1 << pos)) {
+            leds |= 0x80;
+        }
+        writeRegister(getDigitAddress(pos), leds);
+    }
+}
+
+/*!
+ * \brief Write one register with a fixed address command
+ * \param address Register address 0x00..0x0F
+ * \param data Register value
+ */
+void LKM1638Board::writeBus(uint8_t address, uint8_t data)
+{
+#if LKM1638_STATS
+    unsigned long startUs = micros();
+    writeData(address, data);
+    addDisplayStats(address, &data, 1, startUs);
+#else
+    writeData(address, data);
+#endif
+}
+
+/*!
+ * \brief Write registers with one auto increment burst
+ * \param address First register address 0x00..0x0F
+ * \param buf Register values
+ * \param len Number of registers
+ */
+void LKM1638Board::writeBus(uint8_t address, const uint8_t *buf, uint8_t len)
+{
+#if LKM1638_STATS
+    unsigned long startUs = micros();
+    writeData(address, buf, len);
+    addDisplayStats(address, buf, len, startUs);
+#else
+    writeData(address, buf, len);
+#endif
+}
+
+#if LKM1638_TM1638
+/*!
+ * \brief Initialize the TM1638 pins and write display control
+ * \details
+ *      Derived classes with another bus override this function.
+ */
+void LKM1638Board::beginBus()
+{
+    TM1638::begin();
+}
+
+/*!
+ * \brief Clear all display registers of the TM1638
+ * \details
+ *      Derived classes with another bus override this function.
+ */
+void LKM1638Board::clearBus()
+{
+    TM1638::clear();
+}
+#endif
+
+/*!
+ * \brief Read 4 Byte key-scan registers
+ * \return Key-scan registers
+ */
+uint32_t LKM1638Board::readKeys()
+{
+#if LKM1638_STATS
+    unsigned long startUs = micros();
+    uint32_t keys = getKeys();
+    unsigned long durationUs = micros() - startUs;
+
+    // Command and 4 key-scan Bytes in one frame
+    _stats.keyScans++;
+    _stats.bytes += 5;
+    _stats.frames++;
+    _stats.keyUs += durationUs;
+    if (durationUs > _stats.maxKeyUs) {
+        _stats.maxKeyUs = (durationUs > 0xFFFF) ? 0xFFFF : (uint16_t)durationUs;
+    }
+
+    return keys;
+#else
+    return getKeys();
+#endif
+}
+
+#if LKM1638_STATS
+/*!
+ * \brief Add display write to the statistics
+ * \param address First register address
+ * \param buf Register values
+ * \param len Number of registers, 1 for a fixed address write
+ * \param startUs Start time of the write
+ */
+void LKM1638Board::addDisplayStats(uint8_t address, const uint8_t *buf, uint8_t len,
+                                   unsigned long startUs)
+{
+    unsigned long durationUs = micros() - startUs;
+
+    _stats.writes++;
+    _stats.displayUs += durationUs;
+    if (durationUs > _stats.maxDisplayUs) {
+        _stats.maxDisplayUs = (durationUs > 0xFFFF) ? 0xFFFF : (uint16_t)durationUs;
+    }
+
+    // Fixed address: command, address, data. Burst: command, address, data...
+    // Both in a command frame and an address frame.
+    _stats.bytes += (len == 1) ? 3 : (uint32_t)(2 + len);
+    _stats.frames += 2;
+
+    for (uint8_t i = 0; i < len; i++) {
+        uint8_t reg = (uint8_t)((address + i) % NUM_REGISTERS);
+
+        if (_busRegs[reg] == buf[i]) {
+            _stats.redundantWrites++;
+        }
+        _busRegs[reg] = buf[i];
+    }
+}
+#endif
+
+/*!
+ * \brief Write display register
+ * \details
+ *      The register is written immediately, or marked dirty in buffered mode
+ *      when the value changed.
+ * \param address Register address 0x00..0x0F
+ * \param data Register value
+ */
+void LKM1638Board::writeRegister(uint8_t address, uint8_t data)
+{
+    uint16_t mask = (uint16_t)(1U << address);
+
+    if (_buffered) {
+        if (_regs[address] != data) {
+            _regs[address] = data;
+            _dirty |= mask;
+        }
+    } else {
+        _regs[address] = data;
+        _dirty &= (uint16_t)~mask;
+        writeBus(address, data);
+    }
+}
+
+/*!
+ * \brief Write display register only when the value changed
+ * \param address Register address 0x00..0x0F
+ * \param data Register value
+ */
+void LKM1638Board::updateRegister(uint8_t address, uint8_t data)
+{
+    if ((_regs[address] != data) || (_dirty & (1U << address))) {
+        writeRegister(address, data);
+    }
+}
+
+/*!
+ * \brief Write changed digits with one write
+ * \details
+ *      Updates the shadow registers of the digits from the LED digits and
+ *      dots. Digits which changed are written, or marked dirty in buffered
+ *      mode.
+ * \param pos First position 0..7
+ * \param numDigits Number of digits
+ */
+void LKM1638Board::commitDigits(uint8_t pos, uint8_t numDigits)
+{
+    uint16_t changed = 0;
+
+    for (uint8_t i = 0; (i < numDigits) && (pos < _numDigits); i++, pos++) {
+        uint8_t address = getDigitAddress(pos);
+        uint8_t data = _leds[pos];
+
+        if (_dots & (1 << pos)) {
+            data |= 0x80;
+        }
+        if ((_regs[address] != data) || (_dirty & (1U << address))) {
+            _regs[address] = data;
+            changed |= (uint16_t)(1U << address);
+        }
+    }
+
+    commitRegisters(changed);
+}
+
+/*!
+ * \brief Load LED digits and dots from a register image
+ * \param data Buffer of 16 registers, data[0] is address 0x00
+ * \param mask Bit mask of registers to load, bit 0 is address 0x00
+ */
+void LKM1638Board::loadDigits(const uint8_t *data, uint16_t mask)
+{
+    for (uint8_t pos = 0; pos < _numDigits; pos++) {
+        uint8_t address = getDigitAddress(pos);
+
+        if (mask & (1U << address)) {
+            _leds[pos] = (uint8_t)(data[address] & 0x7F);
+            if (data[address] & 0x80) {
+                _dots |= (uint8_t)(1 << pos);
+            } else {
+                _dots &= (uint8_t)~(1 << pos);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Write changed shadow registers, or mark them dirty in buffered mode
+ * \param mask Bit mask of changed registers, bit 0 is address 0x00
+ */
+void LKM1638Board::commitRegisters(uint16_t mask)
+{
+    if (_buffered) {
+        _dirty |= mask;
+    } else {
+        writeRegisters(mask);
+    }
+}
+
+/*!
+ * \brief Write LED segments of a digit
+ * \param pos Position 0..7
+ * \param segments Segment LED's
+ */
+void LKM1638Board::setSegmentsDigit(uint8_t pos, uint8_t segments)
+{
+    if (pos < _numDigits) {
+        _leds[pos] = segments;
+        writeDigit(pos);
+    }
+}
+
+/*!
+ * \brief Write digit
+ * \param pos Position 0..7
+ * \param digit Value 0..9, A..F
+ */
+void LKM1638Board::setDigit(uint8_t pos, uint8_t digit)
+{
+    if (pos < _numDigits) {
+        setSegmentsDigit(pos, getDigitSegments(digit));
+    }
+}
+
+/*!
+ * \brief Write LED segments of multiple digits with one write
+ * \details
+ *      Only digits which changed are written.
+ * \param pos Position of the first segments 0..7
+ * \param segments Segment LED's, segments[0] at the most right position
+ * \param numDigits Number of digits
+ */
+void LKM1638Board::setSegmentsDigits(uint8_t pos, const uint8_t *segments,
+                                     uint8_t numDigits)
+{
+    for (uint8_t i = 0; (i < numDigits) && ((pos + i) < _numDigits); i++) {
+        _leds[pos + i] = segments[i];
+    }
+
+    commitDigits(pos, numDigits);
+}
+
+/*!
+ * \brief Write a TM1638 register image with one write
+ * \details
+ *      Only registers which changed are written. Even addresses contain the
+ *      segments and dot of a digit, odd addresses a dual color LED, see
+ *      getDigitAddress() and getColorLEDAddress().
+ * \param data Buffer of 16 registers, data[0] is address 0x00
+ * \param mask Bit mask of registers to set, bit 0 is address 0x00
+ */
+void LKM1638Board::setRegisters(const uint8_t *data, uint16_t mask)
+{
+    uint16_t changed = 0;
+
+    // Keep digits and dots in sync for the print functions
+    loadDigits(data, mask);
+
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        uint16_t bit = (uint16_t)(1U << address);
+
+        if ((mask & bit) && ((_regs[address] != data[address]) || (_dirty & bit))) {
+            _regs[address] = data[address];
+            changed |= bit;
+        }
+    }
+
+    commitRegisters(changed);
+}
+
+/*!
+ * \brief Write a frame with one burst of 16 registers
+ * \details
+ *      The frame is written immediately, also in buffered mode. Between
+ *      beginUpdate() and endUpdate() only the shadow registers are set. Use
+ *      setRegisters(frame.getRegisters(), 0xFFFF) to write only the registers
+ *      which changed.
+ * \param frame Register image
+ */
+void LKM1638Board::blit(const LKM1638Frame &frame)
+{
+    const uint8_t *data = frame.getRegisters();
+
+    loadDigits(data, 0xFFFF);
+    memcpy(_regs, data, NUM_REGISTERS);
+
+    if (_updateDepth) {
+        _dirty = 0xFFFF;
+        return;
+    }
+    _dirty = 0;
+
+    writeBus(0x00, _regs, NUM_REGISTERS);
+}
+
+/*!
+ * \brief Write an image derived from the shadow registers
+ * \details
+ *      For classes which display the shadow registers differently, such as
+ *      LKM1638Dimmer. The shadow registers are not changed and all pending
+ *      changes count as written. The writes are included in the bus
+ *      statistics. Ignored between beginUpdate() and endUpdate().
+ * \param data Buffer of 16 registers, data[0] is address 0x00
+ * \param plan Registers to write, see planWrites()
+ */
+void LKM1638Board::writeImage(const uint8_t *data, uint16_t plan)
+{
+    if (_updateDepth) {
+        return;
+    }
+
+    writePlan(data, plan);
+    _dirty = 0;
+}
+
+/*!
+ * \brief Get TM1638 register from the shadow registers
+ * \param address Address 0x00..0x0F
+ * \return Register value
+ */
+uint8_t LKM1638Board::getRegister(uint8_t address)
+{
+    if (address >= NUM_REGISTERS) {
+        return 0;
+    }
+
+    return _regs[address];
+}
+
+/*!
+ * \brief Refresh display
+ */
+void LKM1638Board::refresh()
+{
+    for (uint8_t pos = 0; pos < _numDigits; pos++) {
+        writeDigit(pos);
+
+        if (_buffered) {
+            // Rewrite all digit registers on next flush, also when the value
+            // did not change during an update
+            _dirty |= (uint16_t)(1U << getDigitAddress(pos));
+            _updateDirty |= (uint16_t)(1U << getDigitAddress(pos));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Buffered mode
+//------------------------------------------------------------------------------
+/*!
+ * \brief Enable or disable buffered mode
+ * \details
+ *      In buffered mode all display and LED functions only update the shadow
+ *      registers. Call flush() to write the changed registers to the board.
+ *      Disabling buffered mode flushes pending changes. Between beginUpdate()
+ *      and endUpdate() the mode is applied by the last endUpdate().
+ * \param enable true: Buffered mode, false: Write immediately (default)
+ */
+void LKM1638Board::setBuffered(bool enable)
+{
+    if (_updateDepth) {
+        _updateBuffered = enable;
+        return;
+    }
+
+    if (!enable) {
+        flush();
+    }
+    _buffered = enable;
+}
+
+/*!
+ * \brief Get buffered mode
+ * \return true: Buffered mode enabled, false: Write immediately
+ */
+bool LKM1638Board::isBuffered()
+{
+    if (_updateDepth) {
+        return _updateBuffered;
+    }
+
+    return _buffered;
+}
+
+/*!
+ * \brief Write changed registers to the board
+ * \details
+ *      Ignored between beginUpdate() and endUpdate().
+ */
+void LKM1638Board::flush()
+{
+    if (_updateDepth) {
+        return;
+    }
+
+    writeRegisters(_dirty);
+}
+
+/*!
+ * \brief Write part of the changed registers to the board
+ * \details
+ *      Call this function repeatedly from loop() in buffered mode instead of
+ *      flush(). Every call writes at least one register and stops when the
+ *      flush budget is used. Changes made while a frame is written are
+ *      combined with the remaining changed registers.
+ *
+ *      When this function is called from a timer interrupt, disable
+ *      interrupts while the application updates the display.
+ * \retval true Changed registers remaining
+ * \retval false All registers written
+ */
+bool LKM1638Board::poll()
+{
+    uint16_t mask = 0;
+    uint16_t maxBytes;
+    uint16_t numBytes = 0;
+    uint8_t address = _pollAddress;
+    unsigned long startUs;
+    unsigned long byteUs;
+
+    if (_dirty == 0) {
+        return false;
+    }
+
+    // Do not write an incomplete update
+    if (_updateDepth) {
+        return true;
+    }
+
+    // Number of Bytes which fits in the budget. The first call writes one
+    // register to measure the bus speed.
+    if (_byteUs == 0) {
+        maxBytes = 0;
+    } else {
+        maxBytes = (uint16_t)(_flushBudgetUs / _byteUs);
+    }
+
+    // Collect changed registers from the last written address, wrap around
+    for (uint8_t i = 0; i < NUM_REGISTERS; i++) {
+        uint16_t bit = (uint16_t)(1U << address);
+
+        if (_dirty & bit) {
+            uint16_t cost = getWriteCost(mask | bit);
+
+            if ((mask != 0) && (cost > maxBytes)) {
+                break;
+            }
+            mask |= bit;
+            numBytes = cost;
+        }
+        address = (uint8_t)((address + 1) % NUM_REGISTERS);
+    }
+    _pollAddress = address;
+
+    // Write and update average duration of one Byte
+    startUs = micros();
+    writeRegisters(mask);
+    byteUs = (micros() - startUs) / ((numBytes == 0) ? 1 : numBytes);
+    if (byteUs > 0xFFFF) {
+        byteUs = 0xFFFF;
+    }
+    if (_byteUs != 0) {
+        byteUs = (_byteUs + byteUs + 1) / 2;
+    }
+    _byteUs = (byteUs == 0) ? 1 : (uint16_t)byteUs;
+
+    return (_dirty != 0);
+}
+
+/*!
+ * \brief Check if changed registers are not written yet
+ * \retval true Changed registers remaining
+ * \retval false All registers written
+ */
+bool LKM1638Board::isFlushing()
+{
+    return (_dirty != 0);
+}
+
+/*!
+ * \brief Set maximum duration of one poll() call
+ * \param budgetUs Duration in us
+ */
+void LKM1638Board::setFlushBudget(uint16_t budgetUs)
+{
+    _flushBudgetUs = budgetUs;
+}
+
+//------------------------------------------------------------------------------
+// Update transaction
+//------------------------------------------------------------------------------
+/*!
+ * \brief Begin an update
+ * \details
+ *      Until the matching endUpdate(), all display and LED functions only
+ *      update the shadow registers, also when buffered mode is disabled.
+ *      flush() is ignored and poll() does not write. Updates can be nested.
+ */
+void LKM1638Board::beginUpdate()
+{
+    if (_updateDepth == 0) {
+        // Remember the registers on the board to find the net change
+        _updateBuffered = _buffered;
+        _updateDirty = _dirty;
+        memcpy(_updateRegs, _regs, NUM_REGISTERS);
+        _buffered = true;
+    }
+
+    if (_updateDepth < 0xFF) {
+        _updateDepth++;
     }
 }
 
 /*!
- * \brief Turn multiple color LED's on
- * \param leds Byte with 8 LED's
- * \param color
- *      0: Off
- *      1: Green
- *      2: Red
+ * \brief End an update
+ * \details
+ *      The last endUpdate() drops changes which are reverted during the
+ *      update, such as colorLEDsOff() followed by colorLEDsOn() of the same
+ *      LED's. Without buffered mode, the remaining changes are written with
+ *      the fewest writes. In buffered mode they are written by the next
+ *      flush() or poll().
+ */
+void LKM1638Board::endUpdate()
+{
+    uint16_t changed;
+
+    if (_updateDepth == 0) {
+        return;
+    }
+
+    if (--_updateDepth > 0) {
+        return;
+    }
+
+    // Registers which are dirty since beginUpdate() and have their old value
+    // are still on the board
+    changed = (uint16_t)(_dirty & ~_updateDirty);
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        uint16_t bit = (uint16_t)(1U << address);
+
+        if ((changed & bit) && (_regs[address] == _updateRegs[address])) {
+            _dirty &= (uint16_t)~bit;
+        }
+    }
+    _updateDirty = 0;
+
+    _buffered = _updateBuffered;
+    if (!_buffered) {
+        flush();
+    }
+}
+
+/*!
+ * \brief Check if an update is active
+ * \retval true Between beginUpdate() and endUpdate()
+ * \retval false Not updating
+ */
+bool LKM1638Board::isUpdating()
+{
+    return (_updateDepth != 0);
+}
+
+//------------------------------------------------------------------------------
+// Bus statistics
+//------------------------------------------------------------------------------
+/*!
+ * \brief Get bus statistics
+ * \details
+ *      Statistics are only collected when the library is built with
+ *      LKM1638_STATS 1, otherwise all counters are zero.
+ * \param stats Statistics since the last resetStats()
+ */
+void LKM1638Board::getStats(LKM1638Stats *stats)
+{
+#if LKM1638_STATS
+    *stats = _stats;
+#else
+    memset(stats, 0, sizeof(LKM1638Stats));
+#endif
+}
+
+/*!
+ * \brief Reset bus statistics
  */
-void LKM1638Board::colorLEDsOn(uint8_t leds, LedColor color)
+void LKM1638Board::resetStats()
 {
-    for (uint8_t i = 0; i < NUM_COLOR_LEDS; i++) {
-        if (leds & (1 << i)) {
-            setColorLED(i, color);
-        }
-    }
+#if LKM1638_STATS
+    memset(&_stats, 0, sizeof(_stats));
+#endif
 }
 
 /*!
- * \brief Turn multiple color LED's off
- * \param leds Byte with 8 LED's
+ * \brief Write registers with the cheapest combination of writes
+ * \details
+ *      See planWrites(). Registers between changed registers which are
+ *      written by a burst are written with their shadow value.
+ * \param mask Bit mask of registers, bit 0 is address 0x00
  */
-void LKM1638Board::colorLEDsOff(uint8_t leds)
+void LKM1638Board::writeRegisters(uint16_t mask)
 {
-    for (uint8_t i = 0; i < NUM_COLOR_LEDS; i++) {
-        if (leds & (1 << i)) {
-            setColorLED(i, LedOff);
-        }
+    uint16_t plan;
+
+    if (mask == 0) {
+        return;
     }
+
+    plan = planWrites(mask, _byteCost, _frameCost);
+    writePlan(_regs, plan);
+
+    // All registers in the plan are up to date now
+    _dirty &= (uint16_t)~plan;
 }
 
-//------------------------------------------------------------------------------
-// 7-segment display IO
-//------------------------------------------------------------------------------
 /*!
- * \brief Write digit position
- * \param pos Digit number 0 is most right digit, 7 is most left digit
+ * \brief Write the registers of a plan
+ * \details
+ *      Every block of consecutive registers in the plan is one write.
+ * \param data Buffer of 16 registers, data[0] is address 0x00
+ * \param plan Registers to write, see planWrites()
  */
-void LKM1638Board::writeDigit(uint8_t pos)
+void LKM1638Board::writePlan(const uint8_t *data, uint16_t plan)
 {
-    if (pos < NUM_DIGITS) {
-        uint8_t leds = _leds[pos];
-        if (_dots & (1 << pos)) {
-            leds |= 0x80;
+    uint8_t address = 0;
+
+    while (address < NUM_REGISTERS) {
+        uint8_t len = 0;
+
+        while (((address + len) < NUM_REGISTERS) && (plan & (1U << (address + len)))) {
+            len++;
+        }
+
+        if (len == 1) {
+            writeBus(address, data[address]);
+        } else if (len > 1) {
+            writeBus(address, &data[address], len);
         }
-        writeData((swapPos(pos) << 1), leds);
+        address = (uint8_t)(address + len + 1);
     }
 }
 
 /*!
- * \brief Write LED segments of a digit
- * \param pos Position 0..7
- * \param segments Segment LED's
+ * \brief Get cost of writing multiple registers
+ * \param mask Bit mask of registers, bit 0 is address 0x00
+ * \return Cost of the cheapest writes in Byte durations
  */
-void LKM1638Board::setSegmentsDigit(uint8_t pos, uint8_t segments)
+uint16_t LKM1638Board::getWriteCost(uint16_t mask)
 {
-    if (pos < NUM_DIGITS) {
-        _leds[pos] = segments;
-        writeDigit(pos);
+    return getPlanCost(planWrites(mask, _byteCost, _frameCost), _byteCost, _frameCost);
+}
+
+/*!
+ * \brief Plan the cheapest writes of multiple registers
+ * \details
+ *      A fixed address write costs command, address and data Bytes. An auto
+ *      increment burst costs command and address Bytes, plus all registers
+ *      from first to last, including the unchanged registers in between. Both
+ *      need two STB frames.
+ *
+ *      The changed registers form runs of consecutive registers. A burst
+ *      writes one or more neighbouring runs and the gaps between them. The
+ *      cheapest grouping of the runs is found by dynamic programming over
+ *      the runs. Ties resolve to the earliest split: the last write of the
+ *      first i runs starts at the first run j with the lowest cost (strict <),
+ *      so runs are merged into the fewest writes. extras/host/test_planner.cpp
+ *      checks cost and number of writes against brute force for all masks.
+ * \param mask Bit mask of changed registers, bit 0 is address 0x00
+ * \param byteCost Cost of one Byte
+ * \param frameCost Cost of one STB frame
+ * \return Bit mask of registers to write, every block of consecutive bits
+ *      is one write
+ */
+uint16_t LKM1638Board::planWrites(uint16_t mask, uint8_t byteCost, uint8_t frameCost)
+{
+    uint8_t runFirst[NUM_REGISTERS / 2];
+    uint8_t runLast[NUM_REGISTERS / 2];
+    uint16_t cost[(NUM_REGISTERS / 2) + 1];
+    uint8_t from[(NUM_REGISTERS / 2) + 1];
+    uint8_t numRuns = 0;
+    uint16_t plan = 0;
+
+    // Find runs of consecutive changed registers
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        if (mask & (1U << address)) {
+            if ((numRuns == 0) || (runLast[numRuns - 1] != (address - 1))) {
+                runFirst[numRuns++] = address;
+            }
+            runLast[numRuns - 1] = address;
+        }
+    }
+
+    if (numRuns <= 1) {
+        return mask;
+    }
+
+    // cost[i]: cheapest writes of the first i runs, the last write starts at
+    // run from[i]. On a tie the earliest j is kept.
+    cost[0] = 0;
+    for (uint8_t i = 1; i <= numRuns; i++) {
+        cost[i] = 0xFFFF;
+        for (uint8_t j = 0; j < i; j++) {
+            uint16_t c = (uint16_t)(cost[j] +
+                    (byteCost * (2 + runLast[i - 1] - runFirst[j] + 1)) + (frameCost * 2));
+
+            if (c < cost[i]) {
+                cost[i] = c;
+                from[i] = j;
+            }
+        }
+    }
+
+    for (uint8_t i = numRuns; i > 0; i = from[i]) {
+        uint8_t first = runFirst[from[i]];
+        uint8_t len = (uint8_t)(runLast[i - 1] - first + 1);
+
+        plan |= (uint16_t)(((1UL << len) - 1) << first);
     }
+
+    return plan;
 }
 
 /*!
- * \brief Write digit
- * \param pos Position 0..7
- * \param digit Value 0..9, A..F
+ * \brief Get cost of planned writes
+ * \param plan Bit mask from planWrites()
+ * \param byteCost Cost of one Byte
+ * \param frameCost Cost of one STB frame
+ * \return Cost
  */
-void LKM1638Board::setDigit(uint8_t pos, uint8_t digit)
+uint16_t LKM1638Board::getPlanCost(uint16_t plan, uint8_t byteCost, uint8_t frameCost)
 {
-    if (pos < NUM_DIGITS) {
-        if (digit < sizeof(SEGMENT_DATA)) {
-            setSegmentsDigit(pos, pgm_read_byte(&SEGMENT_DATA[digit]));
+    uint16_t cost = 0;
+    bool inBlock = false;
+
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        if (plan & (1U << address)) {
+            if (!inBlock) {
+                // Command and address Bytes, two STB frames
+                cost = (uint16_t)(cost + (2 * byteCost) + (2 * frameCost));
+                inBlock = true;
+            }
+            cost = (uint16_t)(cost + byteCost);
         } else {
-            setSegmentsDigit(pos, 0x00);
+            inBlock = false;
         }
     }
+
+    return cost;
 }
 
 /*!
- * \brief Refresh display
+ * \brief Set cost model of the write planner
+ * \details
+ *      The default counts Bytes only. A frame cost prefers less writes, for
+ *      example when toggling STB is slow compared to a Byte on the bus. The
+ *      cost is also used to limit the duration of poll(), so use the cost of
+ *      one Byte as unit.
+ * \param byteCost Cost of one Byte (default 1)
+ * \param frameCost Cost of one STB frame (default 0)
  */
-void LKM1638Board::refresh()
+void LKM1638Board::setWriteCost(uint8_t byteCost, uint8_t frameCost)
 {
-    for (uint8_t pos = 0; pos < NUM_DIGITS; pos++) {
-        writeDigit(pos);
-    }
+    _byteCost = byteCost;
+    _frameCost = frameCost;
 }
 
 //------------------------------------------------------------------------------
@@ -262,7 +1275,7 @@ void LKM1638Board::refresh()
  */
 void LKM1638Board::dotOn(uint8_t pos)
 {
-    if (pos < NUM_DIGITS) {
+    if (pos < _numDigits) {
         _dots |= (1 << pos);
         writeDigit(pos);
     }
@@ -274,7 +1287,7 @@ void LKM1638Board::dotOn(uint8_t pos)
  */
 void LKM1638Board::dotOff(uint8_t pos)
 {
-    if (pos < NUM_DIGITS) {
+    if (pos < _numDigits) {
         _dots &= ~(1 << pos);
         writeDigit(pos);
     }
@@ -287,7 +1300,10 @@ void LKM1638Board::dotOff(uint8_t pos)
 void LKM1638Board::setDots(uint8_t dots)
 {
     _dots = dots;
-    refresh();
+
+    for (uint8_t pos = 0; pos < _numDigits; pos++) {
+        writeDigit(pos);
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -299,7 +1315,7 @@ void LKM1638Board::setDots(uint8_t dots)
  */
 void LKM1638Board::setPrintPos(uint8_t pos)
 {
-    if (pos < NUM_DIGITS) {
+    if (pos < _numDigits) {
         _pos = pos;
     }
 }
@@ -458,6 +1474,129 @@ void LKM1638Board::print(long value, uint8_t radius, uint8_t maxDigits)
     writeSignedValue((int32_t)value, radius, maxDigits);
 }
 
+//------------------------------------------------------------------------------
+// Display text
+//------------------------------------------------------------------------------
+/*!
+ * \brief Print text
+ * \details
+ *      The last character is displayed at the print position. A '.' turns the
+ *      dot of the previous character on. Text which does not fit is cut off on
+ *      the right.
+ * \param text Text in RAM
+ */
+void LKM1638Board::print(const char *text)
+{
+    writeText(text, false);
+}
+
+/*!
+ * \brief Print text from flash
+ * \details
+ *      Example: print(F("Err"))
+ * \param text Text in flash
+ */
+void LKM1638Board::print(const __FlashStringHelper *text)
+{
+    writeText((const char *)text, true);
+}
+
+/*!
+ * \brief Get 7-segment LED's of a digit
+ * \param digit Digit 0..15
+ * \return Segment LED's, off for digits out of range
+ */
+uint8_t LKM1638Board::getDigitSegments(uint8_t digit)
+{
+    if (digit >= sizeof(SEGMENT_DATA)) {
+        return SEGMENTS_OFF;
+    }
+
+    return pgm_read_byte(&SEGMENT_DATA[digit]);
+}
+
+/*!
+ * \brief Get 7-segment LED's of an ASCII character
+ * \param c ASCII character
+ * \return Segment LED's, off for unsupported characters
+ */
+uint8_t LKM1638Board::getCharSegments(char c)
+{
+    if ((c < ' ') || ((uint8_t)c > 0x7F)) {
+        return SEGMENTS_OFF;
+    }
+
+    return pgm_read_byte(&ASCII_SEGMENT_DATA[c - ' ']);
+}
+
+//------------------------------------------------------------------------------
+// Display fixed point and float
+//------------------------------------------------------------------------------
+/*!
+ * \brief Print fixed point value with decimal point
+ * \details
+ *      Example: printFixed(-1234, 2) displays -12.34. Values which do not fit,
+ *      also with 8 or more fracDigits, display - characters.
+ * \param value Value multiplied by 10^fracDigits
+ * \param fracDigits Number of digits right of the decimal point 0..7
+ */
+void LKM1638Board::printFixed(long value, uint8_t fracDigits)
+{
+    writeFixedValue((int32_t)value, fracDigits, _numDigits);
+}
+
+/*!
+ * \brief Print fixed point value with decimal point and maximum number of
+ *      digits
+ * \param value Value multiplied by 10^fracDigits
+ * \param fracDigits Number of digits right of the decimal point 0..7
+ * \param maxDigits Maximum number of digits including minus char
+ */
+void LKM1638Board::printFixed(long value, uint8_t fracDigits, uint8_t maxDigits)
+{
+    writeFixedValue((int32_t)value, fracDigits, maxDigits);
+}
+
+/*!
+ * \brief Print float with decimal point
+ * \details
+ *      The value is rounded to fracDigits without printf() or dtostrf().
+ * \param value Float value
+ * \param fracDigits Number of digits right of the decimal point 0..7
+ */
+void LKM1638Board::printFloat(float value, uint8_t fracDigits)
+{
+    printFloat(value, fracDigits, _numDigits);
+}
+
+/*!
+ * \brief Print float with decimal point and maximum number of digits
+ * \param value Float value
+ * \param fracDigits Number of digits right of the decimal point 0..7
+ * \param maxDigits Maximum number of digits including minus char
+ */
+void LKM1638Board::printFloat(float value, uint8_t fracDigits, uint8_t maxDigits)
+{
+    float scaled;
+
+    if (fracDigits >= _numDigits) {
+        displayFixedOverflow(maxDigits);
+        return;
+    }
+
+    // Scale and round to nearest
+    scaled = value * (float)pgm_read_dword(&POWERS_OF_10[fracDigits]);
+    scaled += (scaled < 0) ? -0.5f : 0.5f;
+
+    // Out of range or not a number
+    if (!((scaled > -2147483648.0f) && (scaled < 2147483648.0f))) {
+        displayFixedOverflow(maxDigits);
+        return;
+    }
+
+    writeFixedValue((int32_t)scaled, fracDigits, maxDigits);
+}
+
 //------------------------------------------------------------------------------
 // Position, pad and write value to 7-segment display
 //------------------------------------------------------------------------------
@@ -471,113 +1610,344 @@ void LKM1638Board::print(long value, uint8_t radius, uint8_t maxDigits)
 void LKM1638Board::writeUnsignedValue(uint32_t value, uint8_t radius,
                                       uint8_t maxDigits, uint8_t pad)
 {
+    uint8_t digits[LKM1638_MAX_DIGITS];
+    uint8_t numDigits;
+
+    // Convert value to digits and get number of digits in one pass
+    numDigits = formatDigits(value, radius, digits, _numDigits);
+
+    writeUnsignedDigits(digits, numDigits, maxDigits, pad);
+}
+
+/*!
+ * \brief Write signed value to display
+ * \param value signed value -2^31..2^31
+ * \param radius Radius 2 for binary, 10 for decimal, 16 for HEX
+ * \param maxDigits Maximum number of digits
+ */
+void LKM1638Board::writeSignedValue(int32_t value, uint8_t radius, uint8_t maxDigits)
+{
+    uint8_t digits[LKM1638_MAX_DIGITS];
     uint8_t numDigits;
-    uint8_t pos;
+    uint32_t absValue;
+
+    absValue = (value < 0) ? (uint32_t)0 - (uint32_t)value : (uint32_t)value;
+
+    numDigits = formatDigits(absValue, radius, digits, _numDigits);
+
+    writeSignedDigits(digits, numDigits, (value < 0), maxDigits);
+}
+
+/*!
+ * \brief Write digits of an unsigned value to display
+ * \param digits Digits from formatDigits(), least significant digit first
+ * \param numDigits Number of digits from formatDigits()
+ * \param maxDigits Maximum number of digits
+ * \param pad Number of digits starting with a 0
+ */
+void LKM1638Board::writeUnsignedDigits(const uint8_t *digits, uint8_t numDigits,
+                                       uint8_t maxDigits, uint8_t pad)
+{
+    // Check if the value fits in the reserved area on the display
+    if ((numDigits > maxDigits) || ((_pos + numDigits) > _numDigits)) {
+        displayOverflow(maxDigits);
+        return;
+    }
+
+    // Value 0 has no significant digits
+    if ((numDigits == 1) && (digits[0] == 0)) {
+        numDigits = 0;
+    }
 
-    // Get number of digits of the value
-    numDigits = getNumDigits(value, radius);
+    writeDigits(digits, numDigits, maxDigits, pad);
+    commitDigits(_pos, maxDigits);
+}
+
+/*!
+ * \brief Write digits of a signed value to display
+ * \param digits Digits of the absolute value from formatDigits(), least
+ *      significant digit first
+ * \param numDigits Number of digits from formatDigits()
+ * \param negative true: Display minus char
+ * \param maxDigits Maximum number of digits including minus char
+ */
+void LKM1638Board::writeSignedDigits(const uint8_t *digits, uint8_t numDigits,
+                                     bool negative, uint8_t maxDigits)
+{
+    // Number of digits of the value including one minus char
+    numDigits++;
 
     // Check if the value fits in the reserved area on the display
-    if ((numDigits > maxDigits) || ((_pos + numDigits) > NUM_DIGITS)) {
+    if ((numDigits > maxDigits) || ((_pos + numDigits) > _numDigits)) {
         displayOverflow(maxDigits);
         return;
     }
 
-    // Display every digit by dividing the value with the radius:
-    // 10 for DEC, 16 for HEX and 2 for BIN
-    pos = _pos;
-    for (uint8_t i = 0; i < maxDigits; i++) {
-        if ((value == 0) && (i >= pad)) {
-            setSegmentsDigit(pos, 0x00);
+    writeDigits(digits, ((numDigits == 2) && (digits[0] == 0)) ? 0 : (uint8_t)(numDigits - 1),
+                maxDigits, 1);
+
+    // Display or hide minus char, the digit left of the value area is
+    // cleared for a positive value
+    if (negative) {
+        _leds[_pos + numDigits - 1] = SEGMENTS_MINUS;
+    } else if ((_pos + maxDigits) < _numDigits) {
+        _leds[_pos + maxDigits] = SEGMENTS_OFF;
+    }
+
+    commitDigits(_pos, (uint8_t)(((maxDigits < _numDigits) ? maxDigits : _numDigits) + 1));
+}
+
+/*!
+ * \brief Write text to display
+ * \param text Text
+ * \param flash true: Text in flash, false: Text in RAM
+ */
+void LKM1638Board::writeText(const char *text, bool flash)
+{
+    uint8_t segments[LKM1638_MAX_DIGITS];
+    uint8_t numChars = 0;
+    uint8_t maxChars = (uint8_t)(_numDigits - _pos);
+    char c;
+
+    // Render characters from left to right, merge dots with the previous char
+    while ((c = (char)(flash ? pgm_read_byte(text) : *text)) != '\0') {
+        text++;
+        if ((c == '.') && (numChars > 0) && !(segments[numChars - 1] & 0x80)) {
+            segments[numChars - 1] |= 0x80;
+        } else if (numChars < maxChars) {
+            segments[numChars++] = getCharSegments(c);
         } else {
-            setDigit(pos, (uint8_t)(value % radius));
+            break;
         }
-        pos++;
-        value /= radius;
     }
+
+    // Most left character at the highest position
+    for (uint8_t i = 0; i < numChars; i++) {
+        uint8_t pos = (uint8_t)(_pos + numChars - 1 - i);
+
+        _leds[pos] = (uint8_t)(segments[i] & 0x7F);
+        if (segments[i] & 0x80) {
+            _dots |= (uint8_t)(1 << pos);
+        } else {
+            _dots &= (uint8_t)~(1 << pos);
+        }
+    }
+
+    commitDigits(_pos, numChars);
 }
 
 /*!
- * \brief Write signed value to display
- * \param value signed value -2^31..2^31
- * \param radius Radius 2 for binary, 10 for decimal, 16 for HEX
- * \param maxDigits Maximum number of digits
+ * \brief Write fixed point value to display
+ * \details
+ *      Digits, minus char and decimal point are rendered in the LED digits and
+ *      dots first and written with one write.
+ * \param value Value multiplied by 10^fracDigits
+ * \param fracDigits Number of digits right of the decimal point
+ * \param maxDigits Maximum number of digits including minus char
  */
-void LKM1638Board::writeSignedValue(int32_t value, uint8_t radius, uint8_t maxDigits)
+void LKM1638Board::writeFixedValue(int32_t value, uint8_t fracDigits, uint8_t maxDigits)
 {
+    uint8_t digits[LKM1638_MAX_DIGITS];
+    uint8_t numValueDigits;
     uint8_t numDigits;
-    uint8_t pos;
-    bool negative = false;
+    uint32_t absValue;
+    uint8_t pos = _pos;
 
-    if (value < 0) {
-        negative = true;
-        value *= -1;
+    // At least fracDigits + 1 digits are needed, which never fit
+    if (fracDigits >= _numDigits) {
+        displayFixedOverflow(maxDigits);
+        return;
     }
 
-    // Get number of digits of the value including one minus char
-    numDigits = (uint8_t)(getNumDigits((uint32_t)value, radius) + 1);
+    absValue = (value < 0) ? (uint32_t)0 - (uint32_t)value : (uint32_t)value;
 
-    // Check if the value fits in the reserved area on the display
-    if ((numDigits > maxDigits) || ((_pos + numDigits) > NUM_DIGITS)) {
-        displayOverflow(maxDigits);
+    // Display at least one digit left of the decimal point
+    numValueDigits = formatDigits(absValue, DEC, digits, _numDigits);
+    numDigits = (numValueDigits > fracDigits) ? numValueDigits : (uint8_t)(fracDigits + 1);
+
+    // Check if the value and minus char fit in the reserved area on the display
+    if ((numValueDigits > _numDigits) ||
+        ((numDigits + (value < 0)) > maxDigits) ||
+        ((_pos + numDigits + (value < 0)) > _numDigits)) {
+        displayFixedOverflow(maxDigits);
         return;
     }
 
-    // Display every digit by dividing the value with the radius:
-    // 10 for DEC, 16 for HEX and 2 for BIN
-    pos = _pos;
-    for (uint8_t i = 0; i < maxDigits; i++) {
-        if ((value == 0) && (i >= 1)) {
-            setSegmentsDigit(pos, 0x00);
+    for (uint8_t i = 0; (i < maxDigits) && (pos < _numDigits); i++, pos++) {
+        if (i < numDigits) {
+            _leds[pos] = pgm_read_byte(&SEGMENT_DATA[(i < numValueDigits) ? digits[i] : 0]);
+        } else if ((i == numDigits) && (value < 0)) {
+            _leds[pos] = SEGMENTS_MINUS;
         } else {
-            setDigit(pos, (uint8_t)(value % radius));
+            _leds[pos] = SEGMENTS_OFF;
+        }
+
+        // Decimal point right of the units digit
+        if ((fracDigits > 0) && (i == fracDigits)) {
+            _dots |= (uint8_t)(1 << pos);
+        } else {
+            _dots &= (uint8_t)~(1 << pos);
         }
-        pos++;
-        value /= radius;
     }
 
-    // Display or hide minus char
-    if (negative) {
-        pos = (uint8_t)(_pos + numDigits - 1);
-        setSegmentsDigit(pos, SEGMENTS_MINUS);
-    } else {
-        setSegmentsDigit(pos, SEGMENTS_OFF);
+    commitDigits(_pos, maxDigits);
+}
+
+/*!
+ * \brief Render digits in the LED digits at the print position
+ * \details
+ *      The caller writes the rendered digits with commitDigits(), so a print
+ *      is one write of the changed digits.
+ * \param digits Digits, least significant digit first
+ * \param numDigits Number of significant digits, 0 for value 0
+ * \param maxDigits Number of digits to render, unused digits are turned off
+ * \param pad Number of digits starting with a 0
+ */
+void LKM1638Board::writeDigits(const uint8_t *digits, uint8_t numDigits,
+                               uint8_t maxDigits, uint8_t pad)
+{
+    uint8_t pos = _pos;
+
+    for (uint8_t i = 0; (i < maxDigits) && (pos < _numDigits); i++, pos++) {
+        if ((i >= numDigits) && (i >= pad)) {
+            _leds[pos] = SEGMENTS_OFF;
+        } else {
+            _leds[pos] = getDigitSegments((i < numDigits) ? digits[i] : 0);
+        }
     }
 }
 
 /*!
- * \brief Get number of digits of a signed 32-bit value
- * \param value 32-bit signed value
+ * \brief Convert value to digits without runtime division
+ * \details
+ *      Decimal values are converted by subtracting powers of ten, binary,
+ *      octal and HEX values by shifting and masking. Other radiuses fall back
+ *      to division.
+ * \param value Unsigned value
  * \param radius Radius
- * \return Number of digits
+ * \param digits Buffer of maxDigits Bytes for the digits, least significant
+ *      digit first. Only valid when the value fits in maxDigits.
+ * \param maxDigits Maximum number of digits 1..32
+ * \return Number of digits, maxDigits + 1 when the value does not fit
  */
-uint8_t LKM1638Board::getNumDigits(uint32_t value, uint8_t radius)
+uint8_t LKM1638Board::formatDigits(uint32_t value, uint8_t radius, uint8_t *digits,
+                                   uint8_t maxDigits)
 {
     uint8_t numDigits = 1;
 
-    // Calculate the number of digits of a value by dividing with radius
-    for (uint8_t i = 0; i < NUM_DIGITS; i++) {
-        value /= radius;
-        if (value == 0) {
-            break;
+    if (radius < 2) {
+        // Only value 0 can be displayed
+        digits[0] = 0;
+        return (value == 0) ? 1 : (uint8_t)(maxDigits + 1);
+    }
+
+    if (radius == 10) {
+        if (maxDigits < 10) {
+            if (value >= pgm_read_dword(&POWERS_OF_10[maxDigits])) {
+                return (uint8_t)(maxDigits + 1);
+            }
         } else {
-            numDigits++;
+            maxDigits = 10;
+        }
+
+        // Subtract powers of ten, most significant digit first
+        for (uint8_t i = (uint8_t)(maxDigits - 1); i > 0; i--) {
+            uint32_t power = pgm_read_dword(&POWERS_OF_10[i]);
+            uint8_t digit = 0;
+
+            while (value >= power) {
+                value -= power;
+                digit++;
+            }
+            digits[i] = digit;
+            if ((digit != 0) && (numDigits == 1)) {
+                numDigits = (uint8_t)(i + 1);
+            }
+        }
+        digits[0] = (uint8_t)value;
+
+        return numDigits;
+    }
+
+    if ((radius & (radius - 1)) == 0) {
+        // Shift and mask
+        uint8_t shift = 0;
+        uint8_t mask = (uint8_t)(radius - 1);
+
+        while ((1U << shift) < radius) {
+            shift++;
         }
+
+        digits[0] = (uint8_t)(value & mask);
+        value >>= shift;
+        while (value != 0) {
+            if (numDigits >= maxDigits) {
+                return (uint8_t)(maxDigits + 1);
+            }
+            digits[numDigits++] = (uint8_t)(value & mask);
+            value >>= shift;
+        }
+
+        return numDigits;
+    }
+
+    // Other radiuses
+    digits[0] = (uint8_t)(value % radius);
+    value /= radius;
+    while (value != 0) {
+        if (numDigits >= maxDigits) {
+            return (uint8_t)(maxDigits + 1);
+        }
+        digits[numDigits++] = (uint8_t)(value % radius);
+        value /= radius;
     }
 
     return numDigits;
 }
 
+/*!
+ * \brief Get number of digits of a signed 32-bit value
+ * \param value 32-bit signed value
+ * \param radius Radius
+ * \return Number of digits
+ */
+uint8_t LKM1638Board::getNumDigits(uint32_t value, uint8_t radius)
+{
+    uint8_t digits[LKM1638_MAX_DIGITS];
+
+    return formatDigits(value, radius, digits, _numDigits);
+}
+
+/*!
+ * \brief Display fixed point overflow with - characters and dots off
+ * \param numDigits Number of digits to display
+ */
+void LKM1638Board::displayFixedOverflow(uint8_t numDigits)
+{
+    uint8_t pos = _pos;
+
+    for (uint8_t i = 0; (i < numDigits) && (pos < _numDigits); i++, pos++) {
+        _leds[pos] = SEGMENTS_MINUS;
+        _dots &= (uint8_t)~(1 << pos);
+    }
+
+    commitDigits(_pos, numDigits);
+}
+
 /*!
  * \brief Display overflow with - characters
  * \param numDigits Number of digits to display
  */
 void LKM1638Board::displayOverflow(uint8_t numDigits)
 {
+    uint8_t pos = _pos;
+
     // Display minus char on value area
-    for (uint8_t i = 0; i < numDigits; i++) {
-        setSegmentsDigit(_pos + i, SEGMENTS_MINUS);
+    for (uint8_t i = 0; (i < numDigits) && (pos < _numDigits); i++, pos++) {
+        _leds[pos] = SEGMENTS_MINUS;
     }
+
+    commitDigits(_pos, numDigits);
 }
 
 /*!
@@ -588,7 +1958,7 @@ void LKM1638Board::displayOverflow(uint8_t numDigits)
 uint8_t LKM1638Board::swapPos(uint8_t pos)
 {
     // Swap position LSB - MSB
-    return (uint8_t)(NUM_DIGITS - 1 - pos);
+    return (uint8_t)(_numDigits - 1 - pos);
 }
 
 /*!
@@ -599,24 +1969,17 @@ uint8_t LKM1638Board::swapPos(uint8_t pos)
 uint8_t LKM1638Board::swapLeds(uint8_t led)
 {
     // Swap LED's LSB - MSB
-    return (uint8_t)(NUM_COLOR_LEDS - 1 - led);
+    return (uint8_t)(_numColorLeds - 1 - led);
 }
 
 /*!
  * \brief Swap bits
- * \param data 9-bit unsigned value
+ * \param data 8-bit unsigned value
  * \return Swapped bits
  */
 uint8_t LKM1638Board::swapBits(uint8_t data)
 {
-    uint8_t result = 0;
-
     // Swap all bits in a Byte (most significant and least significant bit)
-    for (uint8_t i = 0; i < 8; i++) {
-        result <<= 1;
-        result |= data & 1;
-        data >>= 1;
-    }
-
-    return result;
+    return (uint8_t)((pgm_read_byte(&REVERSED_NIBBLES[data & 0x0F]) << 4) |
+                     pgm_read_byte(&REVERSED_NIBBLES[data >> 4]));
 }
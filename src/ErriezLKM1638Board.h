@@ -34,21 +34,69 @@
 #ifndef ERRIEZ_LKM1638_BOARD_H_
 #define ERRIEZ_LKM1638_BOARD_H_
 
-#include <Arduino.h>
+#include "ErriezLKM1638Platform.h"
 
+#if LKM1638_TM1638
 #include <ErriezTM1638.h>
+#endif
+
+// The number of digits and LED's is set per board with the constructor. The
+// buffers are sized for the largest board, override with build flags for the
+// library and the sketch to save RAM, for example -DLKM1638_MAX_DIGITS=4
+#ifndef LKM1638_MAX_COLOR_LEDS
+#define LKM1638_MAX_COLOR_LEDS  8 //!< Maximum number of dual color LED's of a board
+#endif
+#ifndef LKM1638_MAX_DIGITS
+#define LKM1638_MAX_DIGITS      8 //!< Maximum number of digits of a board
+#endif
+
+#if defined(NUM_DIGITS) || defined(NUM_COLOR_LEDS)
+#error "Set the number of digits and LED's with the LKM1638Board constructor"
+#endif
+#define NUM_COLOR_LEDS    LKM1638_MAX_COLOR_LEDS //!< Default number of dual color LED's
+#define NUM_DIGITS        LKM1638_MAX_DIGITS //!< Default number of digits
+#define NUM_REGISTERS     16 //!< Number of TM1638 display registers
+
+// Register address of digit pos (0 = most right) and dual color LED led of a
+// board with the default number of digits and LED's
+#define LKM1638_DIGIT_ADDRESS(pos)  ((uint8_t)((NUM_DIGITS - 1 - (pos)) << 1)) //!< Digit address
+#define LKM1638_LED_ADDRESS(led)    ((uint8_t)(0x01 + ((NUM_COLOR_LEDS - 1 - (led)) << 1))) //!< LED address
 
-#define NUM_COLOR_LEDS    8 //!< Number of dual color LED's
-#define NUM_DIGITS        8 //!< Number of digits
+#define FLUSH_BUDGET_US   500 //!< Default maximum duration of poll() in us
+#define WRITE_BYTE_COST   1 //!< Default write planner cost of one Byte
+#define WRITE_FRAME_COST  0 //!< Default write planner cost of one STB frame
+
+// Statistics are compiled out by default, enable with build flag -DLKM1638_STATS=1
+#ifndef LKM1638_STATS
+#define LKM1638_STATS     0 //!< Bus statistics disabled
+#endif
 
 #define SEGMENTS_OFF      0b00000000 //!< 7-sgement digit all LED's off
 #define SEGMENTS_MINUS    0b01000000 //!< 7-sgement digit minus character
 #define SEGMENTS_DEGREE   0b01100011 //!< 7-sgement digit degree symbol
 #define SEGMENTS_C        0b00111001 //!< 7-sgement digit Celsius symbol
 
-#if (NUM_COLOR_LEDS > 8)
+#if (LKM1638_MAX_COLOR_LEDS > 8)
 #error "Too many LED's. This won't fit in a 8-bit variable"
 #endif
+#if (LKM1638_MAX_DIGITS > 8)
+#error "Too many digits. This won't fit in a 8-bit variable"
+#endif
+
+// Link-time check of the build flags which change the LKM1638Board class. The
+// public constructors are inline and pass a tag named after the build flags
+// of the sketch, for example LKM1638Config_8_8_0, to the library constructor.
+// Different build flags of the sketch and the library fail with an undefined
+// reference to the library constructor.
+#define LKM1638_CONFIG_NAME_(digits, leds, stats) \
+    LKM1638Config_ ## digits ## _ ## leds ## _ ## stats //!< Tag name
+#define LKM1638_CONFIG_NAME(digits, leds, stats) \
+    LKM1638_CONFIG_NAME_(digits, leds, stats) //!< Tag name of expanded flags
+#define LKM1638_CONFIG \
+    LKM1638_CONFIG_NAME(LKM1638_MAX_DIGITS, LKM1638_MAX_COLOR_LEDS, LKM1638_STATS) //!< Tag
+
+//! Tag of the build flags
+struct LKM1638_CONFIG { };
 
 /*!
  * \brief Dual color LED
@@ -60,14 +108,101 @@ typedef enum {
 } LedColor;
 
 
+// Register image, see ErriezLKM1638Frame.h
+class LKM1638Frame;
+
+/*!
+ * \brief Bus statistics
+ */
+typedef struct {
+    uint32_t writes;            //!< Display write transactions
+    uint32_t bytes;             //!< Bytes on the bus including commands
+    uint32_t frames;            //!< STB frames of display writes and key scans
+    uint32_t keyScans;          //!< Key scans
+    uint32_t redundantWrites;   //!< Registers written with the displayed value
+    uint32_t displayUs;         //!< Total duration of display writes
+    uint32_t keyUs;             //!< Total duration of key scans
+    uint16_t maxDisplayUs;      //!< Longest display write
+    uint16_t maxKeyUs;          //!< Longest key scan
+} LKM1638Stats;
+
+#if LKM1638_TM1638
+//! TM1638 transfers of LKM1638Board with the pins of the TM1638 library
+typedef TM1638 LKM1638Driver;
+#else
+/*!
+ * \brief LKM1638Driver interface
+ * \details
+ *      TM1638 transfers of LKM1638Board without the TM1638 library, same
+ *      functions as the TM1638 class. Implemented by LKM1638BusBoard.
+ */
+class LKM1638Driver
+{
+public:
+    /*!
+     * \brief Destructor
+     */
+    virtual ~LKM1638Driver() {}
+
+    //! \cond
+    virtual void begin() = 0;
+    virtual void end() = 0;
+
+    virtual void displayOn() = 0;
+    virtual void displayOff() = 0;
+    virtual void setBrightness(uint8_t brightness) = 0;
+
+    virtual void clear() = 0;
+    virtual uint32_t getKeys() = 0;
+    virtual void writeData(uint8_t address, uint8_t data) = 0;
+    virtual void writeData(uint8_t address, const uint8_t *buf, uint8_t len) = 0;
+    //! \endcond
+};
+#endif
+
 /*!
  * \brief LKM1638Board class, derived from TM1638 library
+ * \details
+ *      Derived from the LKM1638Driver interface instead when LKM1638_TM1638
+ *      is 0, use LKM1638BusBoard then.
  */
-class LKM1638Board : public TM1638
+class LKM1638Board : public LKM1638Driver
 {
 public:
-    // Constructor with 3 pins
-    LKM1638Board(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin);
+#if LKM1638_TM1638
+    /*!
+     * \brief Constructor with 3 pins, NUM_DIGITS digits and NUM_COLOR_LEDS LED's
+     * \param clkPin Clock pin
+     * \param dioPin Data pin (bi-directional)
+     * \param stbPin Strobe pin (low is enable)
+     */
+    LKM1638Board(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin) :
+            LKM1638Board(clkPin, dioPin, stbPin, NUM_DIGITS, NUM_COLOR_LEDS,
+                         LKM1638_CONFIG()) { }
+
+    /*!
+     * \brief Constructor with 3 pins and board size
+     * \param clkPin Clock pin
+     * \param dioPin Data pin (bi-directional)
+     * \param stbPin Strobe pin (low is enable)
+     * \param numDigits Number of digits 1..LKM1638_MAX_DIGITS
+     * \param numColorLeds Number of dual color LED's 0..LKM1638_MAX_COLOR_LEDS
+     */
+    LKM1638Board(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin, uint8_t numDigits,
+                 uint8_t numColorLeds) :
+            LKM1638Board(clkPin, dioPin, stbPin, numDigits, numColorLeds,
+                         LKM1638_CONFIG()) { }
+#endif
+
+    // Board size and register addresses, override the addresses for a board
+    // which is wired differently
+    uint8_t getNumDigits();
+    uint8_t getNumColorLEDs();
+    virtual uint8_t getDigitAddress(uint8_t pos);
+    virtual uint8_t getColorLEDAddress(uint8_t led);
+
+    // Initialize TM1638 and clear the board
+    virtual void begin();
 
     // Get buttons
     uint8_t getButtons();
@@ -77,12 +212,34 @@ public:
 
     // Set dual color LED's
     void setColorLED(uint8_t led, LedColor color);
+    void setColorLEDs(uint8_t redLeds, uint8_t greenLeds);
+    uint8_t getColorLEDs(LedColor color);
     void colorLEDsOn(uint8_t leds, LedColor color);
     void colorLEDsOff(uint8_t leds);
 
     // Refresh 7-segment display
     void refresh();
 
+    // Buffered mode: collect changes in the shadow registers until flush()
+    void setBuffered(bool enable);
+    bool isBuffered();
+    void flush();
+
+    // Non-blocking flush in buffered mode
+    bool poll();
+    bool isFlushing();
+    void setFlushBudget(uint16_t budgetUs);
+
+    // Update transaction: collect changes and write the net change at once
+    void beginUpdate();
+    void endUpdate();
+    bool isUpdating();
+
+    // Cost model of the write planner
+    void setWriteCost(uint8_t byteCost, uint8_t frameCost);
+    static uint16_t planWrites(uint16_t mask, uint8_t byteCost, uint8_t frameCost);
+    static uint16_t getPlanCost(uint16_t plan, uint8_t byteCost, uint8_t frameCost);
+
     // Control 7-segment dots
     void dotOn(uint8_t pos);
     void dotOff(uint8_t pos);
@@ -95,6 +252,11 @@ public:
     // Write
     void setSegmentsDigit(uint8_t pos, uint8_t leds);
     void setDigit(uint8_t pos, uint8_t digit);
+    void setSegmentsDigits(uint8_t pos, const uint8_t *segments, uint8_t numDigits);
+    void setRegisters(const uint8_t *data, uint16_t mask);
+    void blit(const LKM1638Frame &frame);
+    void writeImage(const uint8_t *data, uint16_t plan);
+    uint8_t getRegister(uint8_t address);
 
     // Notes:  Overloaded functions with default arguments are not allowed, so
     // create multiple functions with different number of arguments.
@@ -128,17 +290,100 @@ public:
     void print(long value, uint8_t radius);
     void print(long value, uint8_t radius, uint8_t maxDigits);
 
+    // Display value with compile-time radius, maximum digits and padding
+    template <uint8_t RADIUS, uint8_t MAX_DIGITS, uint8_t PAD, typename T>
+    void print(T value);
+
+    // Display text
+    void print(const char *text);
+    void print(const __FlashStringHelper *text);
+
+    // Display fixed point value or float with decimal point
+    void printFixed(long value, uint8_t fracDigits);
+    void printFixed(long value, uint8_t fracDigits, uint8_t maxDigits);
+    void printFloat(float value, uint8_t fracDigits);
+    void printFloat(float value, uint8_t fracDigits, uint8_t maxDigits);
+
+    // Convert value to digits
+    static uint8_t formatDigits(uint32_t value, uint8_t radius, uint8_t *digits,
+                                uint8_t maxDigits);
+
+    // Bus statistics, all zero when LKM1638_STATS is 0
+    void getStats(LKM1638Stats *stats);
+    void resetStats();
+
+    // Convert digit or ASCII character to segments
+    static uint8_t getDigitSegments(uint8_t digit);
+    static uint8_t getCharSegments(char c);
+
 protected:
-    uint8_t _leds[NUM_DIGITS];  //!< LED digits
+    // Library constructor, checks the build flags
+#if LKM1638_TM1638
+    LKM1638Board(uint8_t clkPin, uint8_t dioPin, uint8_t stbPin, uint8_t numDigits,
+                 uint8_t numColorLeds, LKM1638_CONFIG config);
+#else
+    LKM1638Board(uint8_t numDigits, uint8_t numColorLeds, LKM1638_CONFIG config);
+#endif
+
+    uint8_t _numDigits;         //!< Number of digits
+    uint8_t _numColorLeds;      //!< Number of dual color LED's
+    uint8_t _leds[LKM1638_MAX_DIGITS]; //!< LED digits
     uint8_t _pos;               //!< Print position
     uint8_t _dots;              //!< Dot LED's
+    uint8_t _regs[NUM_REGISTERS]; //!< Shadow of the TM1638 display registers
+    uint16_t _dirty;            //!< Registers changed since last flush
+    bool _buffered;             //!< Buffered mode enabled
+    uint8_t _pollAddress;       //!< Next register address to write by poll()
+    uint16_t _flushBudgetUs;    //!< Maximum duration of poll()
+    uint16_t _byteUs;           //!< Average duration of one bus Byte
+    uint8_t _byteCost;          //!< Write planner cost of one Byte
+    uint8_t _frameCost;         //!< Write planner cost of one STB frame
+    uint8_t _updateDepth;       //!< Nesting depth of beginUpdate()
+    bool _updateBuffered;       //!< Buffered mode after the last endUpdate()
+    uint16_t _updateDirty;      //!< Dirty registers at the first beginUpdate()
+    uint8_t _updateRegs[NUM_REGISTERS]; //!< Registers at the first beginUpdate()
+#if LKM1638_STATS
+    LKM1638Stats _stats;        //!< Bus statistics
+    uint8_t _busRegs[NUM_REGISTERS]; //!< Registers written to the board
+#endif
 
     void writeDigit(uint8_t pos);
+    void writeBus(uint8_t address, uint8_t data);
+    void writeBus(uint8_t address, const uint8_t *buf, uint8_t len);
+    uint32_t readKeys();
+#if LKM1638_TM1638
+    virtual void beginBus();
+    virtual void clearBus();
+#else
+    virtual void beginBus() = 0;
+    virtual void clearBus() = 0;
+#endif
+#if LKM1638_STATS
+    void addDisplayStats(uint8_t address, const uint8_t *buf, uint8_t len,
+                         unsigned long startUs);
+#endif
+    void writeRegister(uint8_t address, uint8_t data);
+    void updateRegister(uint8_t address, uint8_t data);
+    void writeRegisters(uint16_t mask);
+    void writePlan(const uint8_t *data, uint16_t plan);
+    void commitRegisters(uint16_t mask);
+    void commitDigits(uint8_t pos, uint8_t numDigits);
+    void loadDigits(const uint8_t *data, uint16_t mask);
+    uint16_t getWriteCost(uint16_t mask);
     void writeUnsignedValue(uint32_t value, uint8_t radius, uint8_t maxDigits,
                                     uint8_t pad);
     void writeSignedValue(int32_t value, uint8_t radius, uint8_t maxDigits);
+    void writeUnsignedDigits(const uint8_t *digits, uint8_t numDigits,
+                             uint8_t maxDigits, uint8_t pad);
+    void writeSignedDigits(const uint8_t *digits, uint8_t numDigits, bool negative,
+                           uint8_t maxDigits);
+    void writeFixedValue(int32_t value, uint8_t fracDigits, uint8_t maxDigits);
+    void writeText(const char *text, bool flash);
+    void writeDigits(const uint8_t *digits, uint8_t numDigits, uint8_t maxDigits,
+                     uint8_t pad);
     uint8_t getNumDigits(uint32_t value, uint8_t radius);
     void displayOverflow(uint8_t numDigits);
+    void displayFixedOverflow(uint8_t numDigits);
 
     // Swap bits and bytes
     uint8_t swapBits(uint8_t data);
@@ -146,4 +391,28 @@ protected:
     uint8_t swapLeds(uint8_t led);
 };
 
+/*!
+ * \brief Print value with compile-time radius, maximum digits and padding
+ * \details
+ *      Same output and code as the print() overloads with a runtime radius,
+ *      the template adds no conversion code. Signed types are printed like
+ *      print(long, radius, maxDigits), PAD is ignored.
+ *
+ *      Example: lkm1638.print<DEC, 3, 1>(value);
+ * \tparam RADIUS Radius 2 for binary, 10 for decimal, 16 for HEX
+ * \tparam MAX_DIGITS Maximum number of digits
+ * \tparam PAD Number of digits starting with a 0
+ * \tparam T Value type, 8, 16 or 32-bit signed or unsigned
+ * \param value Display value
+ */
+template <uint8_t RADIUS, uint8_t MAX_DIGITS, uint8_t PAD, typename T>
+void LKM1638Board::print(T value)
+{
+    if ((T)-1 < (T)0) {
+        writeSignedValue((int32_t)value, RADIUS, MAX_DIGITS);
+    } else {
+        writeUnsignedValue((uint32_t)value, RADIUS, MAX_DIGITS, PAD);
+    }
+}
+
 #endif // ERRIEZ_LKM1638_BOARD_H_
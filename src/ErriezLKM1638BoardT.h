@@ -0,0 +1,255 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638BoardT.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_BOARD_T_H_
+#define ERRIEZ_LKM1638_BOARD_T_H_
+
+#include "ErriezLKM1638Platform.h"
+
+#include "ErriezLKM1638Board.h"
+
+#if !LKM1638_TM1638
+#error "LKM1638BoardT requires the TM1638 library, build with LKM1638_TM1638=1"
+#endif
+
+// TM1638 commands
+#define LKM1638_CMD_WRITE_AUTO      0x40 //!< Write data, auto increment address
+#define LKM1638_CMD_READ_KEYS       0x42 //!< Read key-scan data
+#define LKM1638_CMD_WRITE_FIXED     0x44 //!< Write data, fixed address
+#define LKM1638_CMD_ADDRESS         0xC0 //!< Set address
+
+// Direct port I/O only where the port registers are constant: every pin change
+// is then a single SBI or CBI instruction, which is not interrupted.
+#ifndef LKM1638_DIRECT_IO
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || \
+    defined(__AVR_ATmega168__) || defined(__AVR_ATmega168P__)
+#define LKM1638_DIRECT_IO       1 //!< UNO, Nano, Pro Mini: direct port I/O
+#else
+#define LKM1638_DIRECT_IO       0 //!< Other targets: Arduino pin functions
+#endif
+#endif
+
+#if LKM1638_DIRECT_IO
+// Digital pins 0..7 PORTD, 8..13 PORTB, 14..19 (A0..A5) PORTC
+#define LKM1638_PIN_PORT(pin)   ((pin) < 8 ? &PORTD : ((pin) < 14 ? &PORTB : &PORTC))
+#define LKM1638_PIN_DDR(pin)    ((pin) < 8 ? &DDRD : ((pin) < 14 ? &DDRB : &DDRC))
+#define LKM1638_PIN_IN(pin)     ((pin) < 8 ? &PIND : ((pin) < 14 ? &PINB : &PINC))
+#define LKM1638_PIN_MASK(pin)   \
+    ((uint8_t)(1 << ((pin) < 8 ? (pin) : ((pin) < 14 ? (pin) - 8 : (pin) - 14))))
+#ifndef LKM1638_PIN_DELAY
+//! Minimum clock pulse width of 400ns
+#define LKM1638_PIN_DELAY()     __builtin_avr_delay_cycles((F_CPU / 2500000UL) + 1)
+#endif
+#endif
+
+/*!
+ * \brief LKM1638BoardT class with compile-time pins
+ * \details
+ *      Same functionality as LKM1638Board. Display writes and key-scan reads
+ *      use direct port I/O on ATmega328/168 targets instead of digitalWrite()
+ *      and digitalRead(). Other targets, including other AVR's where the port
+ *      registers are looked up at runtime, use the Arduino pin functions with
+ *      constant pins.
+ * \tparam CLK_PIN Clock pin
+ * \tparam DIO_PIN Data pin (bi-directional)
+ * \tparam STB_PIN Strobe pin (low is enable)
+ * \tparam DIGITS Number of digits 1..LKM1638_MAX_DIGITS
+ * \tparam COLOR_LEDS Number of dual color LED's 0..LKM1638_MAX_COLOR_LEDS
+ */
+template <uint8_t CLK_PIN, uint8_t DIO_PIN, uint8_t STB_PIN, uint8_t DIGITS = NUM_DIGITS,
+          uint8_t COLOR_LEDS = NUM_COLOR_LEDS>
+class LKM1638BoardT : public LKM1638Board
+{
+public:
+    /*!
+     * \brief Constructor
+     */
+    LKM1638BoardT() : LKM1638Board(CLK_PIN, DIO_PIN, STB_PIN, DIGITS, COLOR_LEDS)
+    {
+        static_assert((DIGITS > 0) && (DIGITS <= LKM1638_MAX_DIGITS) &&
+                      (COLOR_LEDS <= LKM1638_MAX_COLOR_LEDS),
+                      "Board size exceeds LKM1638_MAX_DIGITS or LKM1638_MAX_COLOR_LEDS");
+#if LKM1638_DIRECT_IO
+        static_assert((CLK_PIN < 20) && (DIO_PIN < 20) && (STB_PIN < 20),
+                      "Direct port I/O supports digital pins 0..19");
+#endif
+    }
+
+    /*!
+     * \brief Read 4 Byte key-scan registers
+     * \return Key-scan registers, BYTE1 in bits 0..7
+     */
+    virtual uint32_t getKeys()
+    {
+        uint32_t keys = 0;
+
+        stbLow();
+        writeBusByte(LKM1638_CMD_READ_KEYS);
+        dioInput();
+        delayMicroseconds(1);
+        for (uint8_t i = 0; i < 4; i++) {
+            keys |= ((uint32_t)readBusByte() << (i * 8));
+        }
+        dioOutput();
+        stbHigh();
+
+        return keys;
+    }
+
+    /*!
+     * \brief Write one display register with a fixed address
+     * \param address Register address 0x00..0x0F
+     * \param data Register value
+     */
+    virtual void writeData(uint8_t address, uint8_t data)
+    {
+        stbLow();
+        writeBusByte(LKM1638_CMD_WRITE_FIXED);
+        stbHigh();
+        stbLow();
+        writeBusByte((uint8_t)(LKM1638_CMD_ADDRESS | (address & 0x0F)));
+        writeBusByte(data);
+        stbHigh();
+    }
+
+    /*!
+     * \brief Write display registers with auto increment address
+     * \param address First register address 0x00..0x0F
+     * \param buf Register values
+     * \param len Number of registers
+     */
+    virtual void writeData(uint8_t address, const uint8_t *buf, uint8_t len)
+    {
+        stbLow();
+        writeBusByte(LKM1638_CMD_WRITE_AUTO);
+        stbHigh();
+        stbLow();
+        writeBusByte((uint8_t)(LKM1638_CMD_ADDRESS | (address & 0x0F)));
+        for (uint8_t i = 0; i < len; i++) {
+            writeBusByte(buf[i]);
+        }
+        stbHigh();
+    }
+
+protected:
+    /*!
+     * \brief Write Byte, LSB first, data latched on rising clock edge
+     * \param data Byte
+     */
+    void writeBusByte(uint8_t data)
+    {
+        for (uint8_t i = 0; i < 8; i++) {
+            clkLow();
+            if (data & 0x01) {
+                dioHigh();
+            } else {
+                dioLow();
+            }
+            pinDelay();
+            clkHigh();
+            pinDelay();
+            data >>= 1;
+        }
+    }
+
+    /*!
+     * \brief Read Byte, LSB first, data valid after falling clock edge
+     * \return Byte
+     */
+    uint8_t readBusByte()
+    {
+        uint8_t data = 0;
+
+        for (uint8_t i = 0; i < 8; i++) {
+            clkLow();
+            pinDelay();
+            clkHigh();
+            if (dioRead()) {
+                data |= (uint8_t)(1 << i);
+            }
+            pinDelay();
+        }
+
+        return data;
+    }
+
+#if LKM1638_DIRECT_IO
+    //! \brief Clock pin low
+    static inline void clkLow()  { *LKM1638_PIN_PORT(CLK_PIN) &= (uint8_t)~LKM1638_PIN_MASK(CLK_PIN); }
+    //! \brief Clock pin high
+    static inline void clkHigh() { *LKM1638_PIN_PORT(CLK_PIN) |= LKM1638_PIN_MASK(CLK_PIN); }
+    //! \brief Data pin low
+    static inline void dioLow()  { *LKM1638_PIN_PORT(DIO_PIN) &= (uint8_t)~LKM1638_PIN_MASK(DIO_PIN); }
+    //! \brief Data pin high
+    static inline void dioHigh() { *LKM1638_PIN_PORT(DIO_PIN) |= LKM1638_PIN_MASK(DIO_PIN); }
+    //! \brief Strobe pin low
+    static inline void stbLow()  { *LKM1638_PIN_PORT(STB_PIN) &= (uint8_t)~LKM1638_PIN_MASK(STB_PIN); }
+    //! \brief Strobe pin high
+    static inline void stbHigh() { *LKM1638_PIN_PORT(STB_PIN) |= LKM1638_PIN_MASK(STB_PIN); }
+    //! \brief Read data pin
+    static inline bool dioRead() { return (*LKM1638_PIN_IN(DIO_PIN) & LKM1638_PIN_MASK(DIO_PIN)) != 0; }
+    //! \brief Data pin input
+    static inline void dioInput()
+    {
+        *LKM1638_PIN_DDR(DIO_PIN) &= (uint8_t)~LKM1638_PIN_MASK(DIO_PIN);
+        *LKM1638_PIN_PORT(DIO_PIN) &= (uint8_t)~LKM1638_PIN_MASK(DIO_PIN);
+    }
+    //! \brief Data pin output
+    static inline void dioOutput() { *LKM1638_PIN_DDR(DIO_PIN) |= LKM1638_PIN_MASK(DIO_PIN); }
+    //! \brief Minimum clock pulse width
+    static inline void pinDelay() { LKM1638_PIN_DELAY(); }
+#else
+    //! \brief Clock pin low
+    static inline void clkLow()  { digitalWrite(CLK_PIN, LOW); }
+    //! \brief Clock pin high
+    static inline void clkHigh() { digitalWrite(CLK_PIN, HIGH); }
+    //! \brief Data pin low
+    static inline void dioLow()  { digitalWrite(DIO_PIN, LOW); }
+    //! \brief Data pin high
+    static inline void dioHigh() { digitalWrite(DIO_PIN, HIGH); }
+    //! \brief Strobe pin low
+    static inline void stbLow()  { digitalWrite(STB_PIN, LOW); }
+    //! \brief Strobe pin high
+    static inline void stbHigh() { digitalWrite(STB_PIN, HIGH); }
+    //! \brief Read data pin
+    static inline bool dioRead() { return digitalRead(DIO_PIN) == HIGH; }
+    //! \brief Data pin input
+    static inline void dioInput() { pinMode(DIO_PIN, INPUT); }
+    //! \brief Data pin output
+    static inline void dioOutput() { pinMode(DIO_PIN, OUTPUT); }
+    //! \brief Minimum clock pulse width
+    static inline void pinDelay() { delayMicroseconds(1); }
+#endif
+};
+
+#endif // ERRIEZ_LKM1638_BOARD_T_H_
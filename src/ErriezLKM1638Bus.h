@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Bus.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_BUS_H_
+#define ERRIEZ_LKM1638_BUS_H_
+
+#include <stdint.h>
+
+// TM1638 commands
+#define LKM1638_BUS_WRITE_AUTO      0x40 //!< Write data, auto increment address
+#define LKM1638_BUS_READ_KEYS       0x42 //!< Read key-scan data
+#define LKM1638_BUS_WRITE_FIXED     0x44 //!< Write data, fixed address
+#define LKM1638_BUS_DISPLAY         0x80 //!< Display control
+#define LKM1638_BUS_DISPLAY_ON      0x08 //!< Display control: display on
+#define LKM1638_BUS_ADDRESS         0xC0 //!< Set address
+
+#define LKM1638_BUS_MAX_FRAME       17 //!< Address and 16 registers
+
+/*!
+ * \brief LKM1638Bus interface
+ * \details
+ *      Transfers complete STB frames to and from a TM1638. STB is low during a
+ *      frame and high between frames. Bytes are transferred LSB first. A
+ *      bus transfers a frame at once, so it can combine pin changes.
+ */
+class LKM1638Bus
+{
+public:
+    /*!
+     * \brief Destructor
+     */
+    virtual ~LKM1638Bus() {}
+
+    /*!
+     * \brief Initialize bus, STB and CLK high
+     */
+    virtual void begin() = 0;
+
+    /*!
+     * \brief Release bus pins
+     */
+    virtual void end() = 0;
+
+    /*!
+     * \brief Write one STB frame
+     * \param data Command and data Bytes
+     * \param len Number of Bytes 1..LKM1638_BUS_MAX_FRAME
+     */
+    virtual void write(const uint8_t *data, uint8_t len) = 0;
+
+    /*!
+     * \brief Write a command and read Bytes in one STB frame
+     * \param command Command, for example LKM1638_BUS_READ_KEYS
+     * \param data Buffer for the read Bytes
+     * \param len Number of Bytes to read
+     */
+    virtual void read(uint8_t command, uint8_t *data, uint8_t len) = 0;
+
+    /*!
+     * \brief Get transfer error
+     * \retval true A transfer failed since begin() or clearError()
+     * \retval false No error, or the bus cannot detect errors
+     */
+    virtual bool isError() { return false; }
+
+    /*!
+     * \brief Clear transfer error
+     */
+    virtual void clearError() {}
+};
+
+#endif // ERRIEZ_LKM1638_BUS_H_
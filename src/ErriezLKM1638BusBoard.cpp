@@ -0,0 +1,218 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638BusBoard.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include "ErriezLKM1638BusBoard.h"
+
+/*!
+ * \brief LKM1638BusBoard constructor
+ * \details
+ *      Called by the inline constructors in the header. The config tag is
+ *      named after the build flags, see LKM1638_CONFIG.
+ * \param bus Bus
+ * \param numDigits Number of digits 1..LKM1638_MAX_DIGITS
+ * \param numColorLeds Number of dual color LED's 0..LKM1638_MAX_COLOR_LEDS
+ * \param config Tag of the build flags
+ */
+LKM1638BusBoard::LKM1638BusBoard(LKM1638Bus &bus, uint8_t numDigits, uint8_t numColorLeds,
+                                 LKM1638_CONFIG config) :
+#if LKM1638_TM1638
+        LKM1638Board(LKM1638_BUS_NO_PIN, LKM1638_BUS_NO_PIN, LKM1638_BUS_NO_PIN,
+                     numDigits, numColorLeds, config),
+#else
+        LKM1638Board(numDigits, numColorLeds, config),
+#endif
+        _bus(bus), _displayEnabled(true), _displayBrightness(LKM1638_BUS_BRIGHTNESS)
+{
+}
+
+//------------------------------------------------------------------------------
+// Release bus
+//------------------------------------------------------------------------------
+/*!
+ * \brief Release bus
+ */
+void LKM1638BusBoard::end()
+{
+    _bus.end();
+}
+
+//------------------------------------------------------------------------------
+// Transfer errors
+//------------------------------------------------------------------------------
+/*!
+ * \brief Get transfer error of the bus
+ * \details
+ *      The board cannot read back the display registers. Check this after
+ *      writes to detect that the display does not show the shadow registers.
+ * \retval true A transfer failed since begin() or clearBusError()
+ * \retval false No error, or the bus cannot detect errors
+ */
+bool LKM1638BusBoard::isBusError()
+{
+    return _bus.isError();
+}
+
+/*!
+ * \brief Clear transfer error of the bus
+ */
+void LKM1638BusBoard::clearBusError()
+{
+    _bus.clearError();
+}
+
+//------------------------------------------------------------------------------
+// Display control
+//------------------------------------------------------------------------------
+/*!
+ * \brief Turn display on
+ */
+void LKM1638BusBoard::displayOn()
+{
+    _displayEnabled = true;
+    writeDisplayControl();
+}
+
+/*!
+ * \brief Turn display off
+ */
+void LKM1638BusBoard::displayOff()
+{
+    _displayEnabled = false;
+    writeDisplayControl();
+}
+
+/*!
+ * \brief Set brightness
+ * \param brightness Brightness 0 (minimum) .. 7 (maximum)
+ */
+void LKM1638BusBoard::setBrightness(uint8_t brightness)
+{
+    _displayBrightness = (uint8_t)(brightness & 0x07);
+    writeDisplayControl();
+}
+
+//------------------------------------------------------------------------------
+// TM1638 transfers
+//------------------------------------------------------------------------------
+/*!
+ * \brief Read 4 Byte key-scan registers
+ * \return Key-scan registers, BYTE1 in bits 0..7
+ */
+uint32_t LKM1638BusBoard::getKeys()
+{
+    uint8_t keys[4];
+
+    _bus.read(LKM1638_BUS_READ_KEYS, keys, sizeof(keys));
+
+    return (uint32_t)keys[0] | ((uint32_t)keys[1] << 8) |
+           ((uint32_t)keys[2] << 16) | ((uint32_t)keys[3] << 24);
+}
+
+/*!
+ * \brief Write one display register with a fixed address
+ * \param address Register address 0x00..0x0F
+ * \param data Register value
+ */
+void LKM1638BusBoard::writeData(uint8_t address, uint8_t data)
+{
+    uint8_t frame[2];
+
+    frame[0] = LKM1638_BUS_WRITE_FIXED;
+    _bus.write(frame, 1);
+
+    frame[0] = (uint8_t)(LKM1638_BUS_ADDRESS | (address & 0x0F));
+    frame[1] = data;
+    _bus.write(frame, 2);
+}
+
+/*!
+ * \brief Write display registers with auto increment address
+ * \param address First register address 0x00..0x0F
+ * \param buf Register values
+ * \param len Number of registers 1..16
+ */
+void LKM1638BusBoard::writeData(uint8_t address, const uint8_t *buf, uint8_t len)
+{
+    uint8_t frame[LKM1638_BUS_MAX_FRAME];
+
+    if (len > (LKM1638_BUS_MAX_FRAME - 1)) {
+        len = LKM1638_BUS_MAX_FRAME - 1;
+    }
+
+    frame[0] = LKM1638_BUS_WRITE_AUTO;
+    _bus.write(frame, 1);
+
+    frame[0] = (uint8_t)(LKM1638_BUS_ADDRESS | (address & 0x0F));
+    memcpy(&frame[1], buf, len);
+    _bus.write(frame, (uint8_t)(len + 1));
+}
+
+//------------------------------------------------------------------------------
+// Private functions
+//------------------------------------------------------------------------------
+/*!
+ * \brief Initialize bus and write display control
+ * \details
+ *      Called by LKM1638Board::begin(), which clears the board and the shadow
+ *      registers afterwards.
+ */
+void LKM1638BusBoard::beginBus()
+{
+    _bus.begin();
+    writeDisplayControl();
+}
+
+/*!
+ * \brief Clear all display registers with one write
+ */
+void LKM1638BusBoard::clearBus()
+{
+    uint8_t zeros[NUM_REGISTERS];
+
+    memset(zeros, 0, sizeof(zeros));
+    writeData(0x00, zeros, NUM_REGISTERS);
+}
+
+/*!
+ * \brief Write display on/off and brightness
+ */
+void LKM1638BusBoard::writeDisplayControl()
+{
+    uint8_t command = (uint8_t)(LKM1638_BUS_DISPLAY | _displayBrightness);
+
+    if (_displayEnabled) {
+        command |= LKM1638_BUS_DISPLAY_ON;
+    }
+
+    _bus.write(&command, 1);
+}
@@ -0,0 +1,104 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638BusBoard.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_BUS_BOARD_H_
+#define ERRIEZ_LKM1638_BUS_BOARD_H_
+
+#include "ErriezLKM1638Platform.h"
+
+#include "ErriezLKM1638Board.h"
+#include "ErriezLKM1638Bus.h"
+
+#define LKM1638_BUS_NO_PIN      0xFF //!< TM1638 pins are not used
+#define LKM1638_BUS_BRIGHTNESS  5    //!< Default brightness
+
+/*!
+ * \brief LKM1638BusBoard class
+ * \details
+ *      Same functionality as LKM1638Board. All TM1638 transfers use a bus
+ *      object instead of the pins of the TM1638 library, for example
+ *      LKM1638ArduinoBus, LKM1638GpioBus or LKM1638FakeBus. Build with
+ *      LKM1638_TM1638=0 to use it without the TM1638 library and the Arduino
+ *      core.
+ */
+class LKM1638BusBoard : public LKM1638Board
+{
+public:
+    /*!
+     * \brief Constructor with NUM_DIGITS digits and NUM_COLOR_LEDS LED's
+     * \param bus Bus
+     */
+    explicit LKM1638BusBoard(LKM1638Bus &bus) :
+            LKM1638BusBoard(bus, NUM_DIGITS, NUM_COLOR_LEDS, LKM1638_CONFIG()) { }
+
+    /*!
+     * \brief Constructor with board size
+     * \param bus Bus
+     * \param numDigits Number of digits 1..LKM1638_MAX_DIGITS
+     * \param numColorLeds Number of dual color LED's 0..LKM1638_MAX_COLOR_LEDS
+     */
+    LKM1638BusBoard(LKM1638Bus &bus, uint8_t numDigits, uint8_t numColorLeds) :
+            LKM1638BusBoard(bus, numDigits, numColorLeds, LKM1638_CONFIG()) { }
+
+    // Release bus, LKM1638Board::begin() initializes the bus
+    virtual void end();
+
+    // Transfer errors of the bus
+    bool isBusError();
+    void clearBusError();
+
+    // Display control
+    virtual void displayOn();
+    virtual void displayOff();
+    virtual void setBrightness(uint8_t brightness);
+
+    // TM1638 transfers
+    virtual uint32_t getKeys();
+    virtual void writeData(uint8_t address, uint8_t data);
+    virtual void writeData(uint8_t address, const uint8_t *buf, uint8_t len);
+
+protected:
+    // Library constructor, checks the build flags
+    LKM1638BusBoard(LKM1638Bus &bus, uint8_t numDigits, uint8_t numColorLeds,
+                    LKM1638_CONFIG config);
+
+    LKM1638Bus &_bus;           //!< Bus
+    bool _displayEnabled;       //!< Display on
+    uint8_t _displayBrightness; //!< Brightness 0..7
+
+    virtual void beginBus();
+    virtual void clearBus();
+    void writeDisplayControl();
+};
+
+#endif // ERRIEZ_LKM1638_BUS_BOARD_H_
@@ -0,0 +1,255 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Buttons.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include "ErriezLKM1638Buttons.h"
+
+#if (BUTTON_EVENT_QUEUE_SIZE & (BUTTON_EVENT_QUEUE_SIZE - 1))
+#error "BUTTON_EVENT_QUEUE_SIZE must be a power of 2"
+#endif
+
+/*!
+ * \brief LKM1638Buttons constructor
+ * \param board LKM1638 board
+ */
+LKM1638Buttons::LKM1638Buttons(LKM1638Board &board) :
+        _board(board), _lastScanMs(0), _scanIntervalMs(BUTTON_SCAN_INTERVAL_MS),
+        _debounceScans(BUTTON_DEBOUNCE_SCANS), _longPressMs(BUTTON_LONG_PRESS_MS),
+        _repeatMs(BUTTON_REPEAT_MS), _buttons(0), _head(0), _tail(0)
+{
+    memset(_counters, 0, sizeof(_counters));
+    memset(_holdScans, 0, sizeof(_holdScans));
+    updateTiming();
+}
+
+//------------------------------------------------------------------------------
+// Configuration
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set scan interval
+ * \details
+ *      When scan() is called instead of poll(), set the interval of the scan()
+ *      calls.
+ * \param intervalMs Interval in ms between two button scans by poll()
+ */
+void LKM1638Buttons::setScanInterval(uint8_t intervalMs)
+{
+    _scanIntervalMs = (intervalMs == 0) ? 1 : intervalMs;
+    updateTiming();
+}
+
+/*!
+ * \brief Set debounce
+ * \param numScans Number of scans a button must be stable to change state
+ */
+void LKM1638Buttons::setDebounce(uint8_t numScans)
+{
+    _debounceScans = (numScans == 0) ? 1 : numScans;
+}
+
+/*!
+ * \brief Set long press and auto repeat time
+ * \param longPressMs Time in ms to generate a long press event, 0 to disable
+ * \param repeatMs Interval in ms of repeat events after a long press, 0 to
+ *      disable
+ */
+void LKM1638Buttons::setLongPress(uint16_t longPressMs, uint16_t repeatMs)
+{
+    _longPressMs = longPressMs;
+    _repeatMs = repeatMs;
+    updateTiming();
+}
+
+//------------------------------------------------------------------------------
+// Scan buttons
+//------------------------------------------------------------------------------
+/*!
+ * \brief Scan buttons when the scan interval elapsed
+ * \details
+ *      Call this function from loop() as often as possible.
+ */
+void LKM1638Buttons::poll()
+{
+    unsigned long now = millis();
+
+    if ((now - _lastScanMs) >= _scanIntervalMs) {
+        _lastScanMs = now;
+        scan();
+    }
+}
+
+/*!
+ * \brief Read and debounce buttons once
+ * \details
+ *      Call this function from loop() at the scan interval, or use poll().
+ *      Do not call it from an interrupt: the key-scan uses the same pins as
+ *      the display writes of the board, so a key-scan during a display write
+ *      corrupts both transfers.
+ */
+void LKM1638Buttons::scan()
+{
+    uint8_t buttons = _board.getButtons();
+    uint8_t pressed = 0;
+
+    for (uint8_t button = 0; button < NUM_BUTTONS; button++) {
+        uint8_t bit = (uint8_t)(1 << button);
+
+        // Count up while the button is down, count down while the button is up
+        if (buttons & bit) {
+            if (_counters[button] < _debounceScans) {
+                _counters[button]++;
+            }
+        } else if (_counters[button] > 0) {
+            _counters[button]--;
+        }
+
+        if (_buttons & bit) {
+            if (_counters[button] == 0) {
+                _buttons &= (uint8_t)~bit;
+                addEvent(ButtonRelease, bit);
+            } else {
+                updateHold(button);
+            }
+        } else if (_counters[button] >= _debounceScans) {
+            _buttons |= bit;
+            _holdScans[button] = 0;
+            pressed |= bit;
+            addEvent(ButtonPress, bit);
+        }
+    }
+
+    // Chord when a button is pressed while one or more buttons are down
+    if (pressed && (_buttons & (uint8_t)(_buttons - 1))) {
+        addEvent(ButtonChord, _buttons);
+    }
+}
+
+/*!
+ * \brief Get debounced buttons
+ * \return Value of 8 buttons
+ */
+uint8_t LKM1638Buttons::getButtons()
+{
+    return _buttons;
+}
+
+//------------------------------------------------------------------------------
+// Events
+//------------------------------------------------------------------------------
+/*!
+ * \brief Check if button events are available
+ * \retval true One or more events in the queue
+ * \retval false Queue empty
+ */
+bool LKM1638Buttons::available()
+{
+    return (_head != _tail);
+}
+
+/*!
+ * \brief Read oldest button event
+ * \details
+ *      scan() is the only writer and read() the only reader of the queue.
+ * \param event Event
+ * \retval true Event read
+ * \retval false Queue empty
+ */
+bool LKM1638Buttons::read(ButtonEvent *event)
+{
+    uint8_t tail = _tail;
+
+    if (tail == _head) {
+        return false;
+    }
+
+    event->type = _events[tail].type;
+    event->buttons = _events[tail].buttons;
+    _tail = (uint8_t)((tail + 1) & (BUTTON_EVENT_QUEUE_SIZE - 1));
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Private functions
+//------------------------------------------------------------------------------
+/*!
+ * \brief Generate long press and repeat events of a button which is down
+ * \param button Button 0..7
+ */
+void LKM1638Buttons::updateHold(uint8_t button)
+{
+    uint8_t bit = (uint8_t)(1 << button);
+
+    if ((_longPressScans == 0) ||
+        ((_repeatScans == 0) && (_holdScans[button] >= _longPressScans))) {
+        return;
+    }
+
+    _holdScans[button]++;
+
+    if (_holdScans[button] == _longPressScans) {
+        addEvent(ButtonLongPress, bit);
+    } else if (_holdScans[button] >= (_longPressScans + _repeatScans)) {
+        addEvent(ButtonRepeat, bit);
+        _holdScans[button] = _longPressScans;
+    }
+}
+
+/*!
+ * \brief Add event to the queue
+ * \details
+ *      The event is dropped when the queue is full.
+ * \param type Event type
+ * \param buttons Buttons
+ */
+void LKM1638Buttons::addEvent(ButtonEventType type, uint8_t buttons)
+{
+    uint8_t head = _head;
+    uint8_t next = (uint8_t)((head + 1) & (BUTTON_EVENT_QUEUE_SIZE - 1));
+
+    if (next == _tail) {
+        return;
+    }
+
+    _events[head].type = type;
+    _events[head].buttons = buttons;
+    _head = next;
+}
+
+/*!
+ * \brief Convert long press and repeat time to number of scans
+ */
+void LKM1638Buttons::updateTiming()
+{
+    _longPressScans = (uint16_t)((_longPressMs + _scanIntervalMs - 1) / _scanIntervalMs);
+    _repeatScans = (uint16_t)((_repeatMs + _scanIntervalMs - 1) / _scanIntervalMs);
+}
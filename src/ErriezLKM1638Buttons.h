@@ -0,0 +1,119 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Buttons.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_BUTTONS_H_
+#define ERRIEZ_LKM1638_BUTTONS_H_
+
+#include "ErriezLKM1638Platform.h"
+
+#include "ErriezLKM1638Board.h"
+
+#define NUM_BUTTONS                 8   //!< Number of buttons
+#define BUTTON_EVENT_QUEUE_SIZE     8   //!< Number of events, power of 2
+
+#define BUTTON_SCAN_INTERVAL_MS     5   //!< Default scan interval
+#define BUTTON_DEBOUNCE_SCANS       4   //!< Default number of debounce scans
+#define BUTTON_LONG_PRESS_MS        800 //!< Default long press time
+#define BUTTON_REPEAT_MS            200 //!< Default auto repeat interval
+
+/*!
+ * \brief Button event type
+ */
+typedef enum {
+    ButtonPress = 0,        //!< Button pressed
+    ButtonRelease = 1,      //!< Button released
+    ButtonLongPress = 2,    //!< Button hold down for the long press time
+    ButtonRepeat = 3,       //!< Button still down after a long press
+    ButtonChord = 4         //!< Multiple buttons down at the same time
+} ButtonEventType;
+
+/*!
+ * \brief Button event
+ */
+typedef struct {
+    ButtonEventType type;   //!< Event type
+    uint8_t buttons;        //!< Button bit, or all buttons down for a chord
+} ButtonEvent;
+
+
+/*!
+ * \brief LKM1638Buttons class
+ * \details
+ *      Scans the buttons of a LKM1638Board at a fixed interval, debounces
+ *      every button and stores button events in a queue.
+ */
+class LKM1638Buttons
+{
+public:
+    // Constructor
+    explicit LKM1638Buttons(LKM1638Board &board);
+
+    // Configuration
+    void setScanInterval(uint8_t intervalMs);
+    void setDebounce(uint8_t numScans);
+    void setLongPress(uint16_t longPressMs, uint16_t repeatMs);
+
+    // Scan buttons
+    void poll();
+    void scan();
+
+    // Debounced buttons
+    uint8_t getButtons();
+
+    // Events
+    bool available();
+    bool read(ButtonEvent *event);
+
+protected:
+    LKM1638Board &_board;                   //!< Board with the buttons
+    unsigned long _lastScanMs;              //!< Time of last scan
+    uint8_t _scanIntervalMs;                //!< Scan interval
+    uint8_t _debounceScans;                 //!< Scans to accept a change
+    uint16_t _longPressMs;                  //!< Long press time
+    uint16_t _repeatMs;                     //!< Auto repeat interval
+    uint16_t _longPressScans;               //!< Scans to long press
+    uint16_t _repeatScans;                  //!< Scans between repeats
+    uint8_t _counters[NUM_BUTTONS];         //!< Debounce integrators
+    uint16_t _holdScans[NUM_BUTTONS];       //!< Scans a button is down
+    uint8_t _buttons;                       //!< Debounced buttons
+
+    volatile ButtonEvent _events[BUTTON_EVENT_QUEUE_SIZE]; //!< Event queue
+    volatile uint8_t _head;                 //!< Event write index
+    volatile uint8_t _tail;                 //!< Event read index
+
+    void updateHold(uint8_t button);
+    void addEvent(ButtonEventType type, uint8_t buttons);
+    void updateTiming();
+};
+
+#endif // ERRIEZ_LKM1638_BUTTONS_H_
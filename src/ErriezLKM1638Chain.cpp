@@ -0,0 +1,465 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Chain.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include "ErriezLKM1638Chain.h"
+
+/*!
+ * \brief LKM1638Chain constructor
+ * \param boards Array of boards, 0 is most right board
+ * \param numBoards Number of boards in the array
+ */
+LKM1638Chain::LKM1638Chain(LKM1638Board *boards, uint8_t numBoards) :
+        _boards(boards), _numBoards(0), _pos(0), _pollBoard(0)
+{
+    uint16_t numDigits = 0;
+
+    // Maximum number of digits must fit in a Byte
+    while (_numBoards < numBoards) {
+        numDigits += _boards[_numBoards].getNumDigits();
+        if (numDigits > 0xFF) {
+            break;
+        }
+        _numBoards++;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Initialize and control all boards
+//------------------------------------------------------------------------------
+/*!
+ * \brief Initialize all boards in buffered mode
+ */
+void LKM1638Chain::begin()
+{
+    for (uint8_t i = 0; i < _numBoards; i++) {
+        _boards[i].begin();
+        _boards[i].setBuffered(true);
+    }
+}
+
+/*!
+ * \brief Release pins of all boards
+ */
+void LKM1638Chain::end()
+{
+    for (uint8_t i = 0; i < _numBoards; i++) {
+        _boards[i].end();
+    }
+}
+
+/*!
+ * \brief Turn all LED's of all boards off
+ */
+void LKM1638Chain::clear()
+{
+    for (uint8_t i = 0; i < _numBoards; i++) {
+        _boards[i].clear();
+    }
+}
+
+/*!
+ * \brief Set brightness of all boards
+ * \param brightness Brightness 0..7
+ */
+void LKM1638Chain::setBrightness(uint8_t brightness)
+{
+    for (uint8_t i = 0; i < _numBoards; i++) {
+        _boards[i].setBrightness(brightness);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Write changes
+//------------------------------------------------------------------------------
+/*!
+ * \brief Write changed registers of all boards
+ */
+void LKM1638Chain::flush()
+{
+    for (uint8_t i = 0; i < _numBoards; i++) {
+        _boards[i].flush();
+    }
+}
+
+/*!
+ * \brief Write part of the changed registers of one board
+ * \details
+ *      Boards are written one after another, every call within the flush
+ *      budget of the board.
+ * \retval true Changed registers remaining
+ * \retval false All registers of all boards written
+ */
+bool LKM1638Chain::poll()
+{
+    bool flushing = false;
+
+    if (_numBoards == 0) {
+        return false;
+    }
+
+    // Find next board with changes
+    for (uint8_t i = 0; i < _numBoards; i++) {
+        if (_boards[_pollBoard].isFlushing()) {
+            break;
+        }
+        if (++_pollBoard >= _numBoards) {
+            _pollBoard = 0;
+        }
+    }
+
+    _boards[_pollBoard].poll();
+
+    for (uint8_t i = 0; i < _numBoards; i++) {
+        if (_boards[i].isFlushing()) {
+            flushing = true;
+        }
+    }
+
+    return flushing;
+}
+
+//------------------------------------------------------------------------------
+// Boards
+//------------------------------------------------------------------------------
+/*!
+ * \brief Get board
+ * \param board Board number, 0 is most right board
+ * \return Board or NULL
+ */
+LKM1638Board *LKM1638Chain::getBoard(uint8_t board)
+{
+    if (board < _numBoards) {
+        return &_boards[board];
+    }
+
+    return NULL;
+}
+
+/*!
+ * \brief Get number of boards
+ * \return Number of boards
+ */
+uint8_t LKM1638Chain::getNumBoards()
+{
+    return _numBoards;
+}
+
+/*!
+ * \brief Get number of digits of all boards
+ * \return Number of digits
+ */
+uint8_t LKM1638Chain::getNumDigits()
+{
+    uint8_t numDigits = 0;
+
+    for (uint8_t i = 0; i < _numBoards; i++) {
+        numDigits = (uint8_t)(numDigits + _boards[i].getNumDigits());
+    }
+
+    return numDigits;
+}
+
+//------------------------------------------------------------------------------
+// Buttons
+//------------------------------------------------------------------------------
+/*!
+ * \brief Read buttons of all boards
+ * \details
+ *      Every board has its own STB pin, so the boards are scanned one after
+ *      another with one key-scan transaction per board.
+ * \param buttons Buffer with one Byte per board, 0 is most right board
+ */
+void LKM1638Chain::getButtons(uint8_t *buttons)
+{
+    for (uint8_t i = 0; i < _numBoards; i++) {
+        buttons[i] = _boards[i].getButtons();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Dual color LED's
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set dual color LED
+ * \param led LED number, 0 is most right LED of board 0
+ * \param color LedOff, LedRed or LedGreen
+ */
+void LKM1638Chain::setColorLED(uint8_t led, LedColor color)
+{
+    for (uint8_t i = 0; i < _numBoards; i++) {
+        if (led < _boards[i].getNumColorLEDs()) {
+            _boards[i].setColorLED(led, color);
+            return;
+        }
+        led = (uint8_t)(led - _boards[i].getNumColorLEDs());
+    }
+}
+
+//------------------------------------------------------------------------------
+// 7-segment display
+//------------------------------------------------------------------------------
+/*!
+ * \brief Turn dot LED on
+ * \param pos Position, 0 is most right digit of board 0
+ */
+void LKM1638Chain::dotOn(uint8_t pos)
+{
+    LKM1638Board *board = findDigit(&pos);
+
+    if (board != NULL) {
+        board->dotOn(pos);
+    }
+}
+
+/*!
+ * \brief Turn dot LED off
+ * \param pos Position, 0 is most right digit of board 0
+ */
+void LKM1638Chain::dotOff(uint8_t pos)
+{
+    LKM1638Board *board = findDigit(&pos);
+
+    if (board != NULL) {
+        board->dotOff(pos);
+    }
+}
+
+/*!
+ * \brief Set print position
+ * \param pos Position, 0 is most right digit of board 0
+ */
+void LKM1638Chain::setPrintPos(uint8_t pos)
+{
+    if (pos < getNumDigits()) {
+        _pos = pos;
+    }
+}
+
+/*!
+ * \brief Get print position
+ * \return Position
+ */
+uint8_t LKM1638Chain::getPrintPos()
+{
+    return _pos;
+}
+
+/*!
+ * \brief Write LED segments of a digit
+ * \param pos Position, 0 is most right digit of board 0
+ * \param segments Segment LED's
+ */
+void LKM1638Chain::setSegmentsDigit(uint8_t pos, uint8_t segments)
+{
+    LKM1638Board *board = findDigit(&pos);
+
+    if (board != NULL) {
+        board->setSegmentsDigit(pos, segments);
+    }
+}
+
+/*!
+ * \brief Write digit
+ * \param pos Position, 0 is most right digit of board 0
+ * \param digit Value 0..9, A..F
+ */
+void LKM1638Chain::setDigit(uint8_t pos, uint8_t digit)
+{
+    LKM1638Board *board = findDigit(&pos);
+
+    if (board != NULL) {
+        board->setDigit(pos, digit);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Display unsigned long
+//------------------------------------------------------------------------------
+void LKM1638Chain::print(unsigned long value)
+{
+    writeUnsignedValue((uint32_t)value, DEC, getMaxDigits(), 1);
+}
+
+void LKM1638Chain::print(unsigned long value, uint8_t radius)
+{
+    writeUnsignedValue((uint32_t)value, radius, getMaxDigits(), 1);
+}
+
+void LKM1638Chain::print(unsigned long value, uint8_t radius, uint8_t maxDigits)
+{
+    writeUnsignedValue((uint32_t)value, radius, maxDigits, 1);
+}
+
+void LKM1638Chain::print(unsigned long value, uint8_t radius, uint8_t maxDigits, uint8_t pad)
+{
+    writeUnsignedValue((uint32_t)value, radius, maxDigits, pad);
+}
+
+//------------------------------------------------------------------------------
+// Display long
+//------------------------------------------------------------------------------
+void LKM1638Chain::print(long value)
+{
+    writeSignedValue((int32_t)value, DEC, getMaxDigits());
+}
+
+void LKM1638Chain::print(long value, uint8_t radius)
+{
+    writeSignedValue((int32_t)value, radius, getMaxDigits());
+}
+
+void LKM1638Chain::print(long value, uint8_t radius, uint8_t maxDigits)
+{
+    writeSignedValue((int32_t)value, radius, maxDigits);
+}
+
+//------------------------------------------------------------------------------
+// Position, pad and write value to 7-segment display
+//------------------------------------------------------------------------------
+/*!
+ * \brief Write unsigned value to display
+ * \param value Unsigned value 0..2^32
+ * \param radius Radius 2 for binary, 10 for decimal, 16 for HEX
+ * \param maxDigits Maximum number of digits
+ * \param pad Number of digits starting with a 0
+ */
+void LKM1638Chain::writeUnsignedValue(uint32_t value, uint8_t radius,
+                                      uint8_t maxDigits, uint8_t pad)
+{
+    uint8_t digits[MAX_CHAIN_DIGITS];
+    uint8_t numDigits;
+
+    numDigits = LKM1638Board::formatDigits(value, radius, digits, MAX_CHAIN_DIGITS);
+
+    // Check if the value fits in the reserved area on the display
+    if ((numDigits > maxDigits) || ((_pos + numDigits) > getNumDigits())) {
+        displayOverflow(maxDigits);
+        return;
+    }
+
+    writeDigits(digits, (value == 0) ? 0 : numDigits, maxDigits, pad);
+}
+
+/*!
+ * \brief Write signed value to display
+ * \param value signed value -2^31..2^31
+ * \param radius Radius 2 for binary, 10 for decimal, 16 for HEX
+ * \param maxDigits Maximum number of digits including minus char
+ */
+void LKM1638Chain::writeSignedValue(int32_t value, uint8_t radius, uint8_t maxDigits)
+{
+    uint8_t digits[MAX_CHAIN_DIGITS];
+    uint8_t numDigits;
+    uint32_t absValue;
+
+    absValue = (value < 0) ? (uint32_t)0 - (uint32_t)value : (uint32_t)value;
+
+    // Get number of digits of the value including one minus char
+    numDigits = (uint8_t)(LKM1638Board::formatDigits(absValue, radius, digits,
+                                                     MAX_CHAIN_DIGITS) + 1);
+
+    // Check if the value fits in the reserved area on the display
+    if ((numDigits > maxDigits) || ((_pos + numDigits) > getNumDigits())) {
+        displayOverflow(maxDigits);
+        return;
+    }
+
+    writeDigits(digits, (absValue == 0) ? 0 : (uint8_t)(numDigits - 1), maxDigits, 1);
+
+    // Display or hide minus char like LKM1638Board, the digit left of the
+    // value area is cleared for a positive value
+    if (value < 0) {
+        setSegmentsDigit((uint8_t)(_pos + numDigits - 1), SEGMENTS_MINUS);
+    } else if ((_pos + maxDigits) < getNumDigits()) {
+        setSegmentsDigit((uint8_t)(_pos + maxDigits), SEGMENTS_OFF);
+    }
+}
+
+/*!
+ * \brief Write digits to the display at the print position
+ * \param digits Digits, least significant digit first
+ * \param numDigits Number of significant digits, 0 for value 0
+ * \param maxDigits Number of digits to write, unused digits are turned off
+ * \param pad Number of digits starting with a 0
+ */
+void LKM1638Chain::writeDigits(const uint8_t *digits, uint8_t numDigits,
+                               uint8_t maxDigits, uint8_t pad)
+{
+    uint8_t pos = _pos;
+
+    for (uint8_t i = 0; (i < maxDigits) && (pos < getNumDigits()); i++) {
+        if ((i >= numDigits) && (i >= pad)) {
+            setSegmentsDigit(pos, SEGMENTS_OFF);
+        } else {
+            setDigit(pos, (i < numDigits) ? digits[i] : 0);
+        }
+        pos++;
+    }
+}
+
+/*!
+ * \brief Display overflow with - characters
+ * \param numDigits Number of digits to display
+ */
+void LKM1638Chain::displayOverflow(uint8_t numDigits)
+{
+    for (uint8_t i = 0; (i < numDigits) && ((_pos + i) < getNumDigits()); i++) {
+        setSegmentsDigit((uint8_t)(_pos + i), SEGMENTS_MINUS);
+    }
+}
+
+/*!
+ * \brief Find the board of a digit
+ * \param pos Position in the chain, changed to the position on the board
+ * \return Board or NULL when pos is out of range
+ */
+LKM1638Board *LKM1638Chain::findDigit(uint8_t *pos)
+{
+    for (uint8_t i = 0; i < _numBoards; i++) {
+        if (*pos < _boards[i].getNumDigits()) {
+            return &_boards[i];
+        }
+        *pos = (uint8_t)(*pos - _boards[i].getNumDigits());
+    }
+
+    return NULL;
+}
+
+/*!
+ * \brief Get number of digits from the print position to the most left digit
+ * \return Number of digits
+ */
+uint8_t LKM1638Chain::getMaxDigits()
+{
+    return (uint8_t)(getNumDigits() - _pos);
+}
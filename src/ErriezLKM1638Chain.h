@@ -0,0 +1,118 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Chain.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_CHAIN_H_
+#define ERRIEZ_LKM1638_CHAIN_H_
+
+#include "ErriezLKM1638Platform.h"
+
+#include "ErriezLKM1638Board.h"
+
+#define MAX_CHAIN_DIGITS    32  //!< Maximum number of digits of a value
+
+/*!
+ * \brief LKM1638Chain class
+ * \details
+ *      Multiple LKM1638 boards sharing the CLK and DIO pins, each with its own
+ *      STB pin, as one wide display. Board 0 is the most right board. The
+ *      boards may have a different number of digits and LED's. All boards use
+ *      buffered mode.
+ */
+class LKM1638Chain
+{
+public:
+    // Constructor with an array of boards
+    LKM1638Chain(LKM1638Board *boards, uint8_t numBoards);
+
+    // Initialize and control all boards
+    void begin();
+    void end();
+    void clear();
+    void setBrightness(uint8_t brightness);
+
+    // Write changes of all boards
+    void flush();
+    bool poll();
+
+    // Get board and size
+    LKM1638Board *getBoard(uint8_t board);
+    uint8_t getNumBoards();
+    uint8_t getNumDigits();
+
+    // Get buttons of all boards, one Byte and one key-scan per board
+    void getButtons(uint8_t *buttons);
+
+    // Set dual color LED's
+    void setColorLED(uint8_t led, LedColor color);
+
+    // Control 7-segment dots
+    void dotOn(uint8_t pos);
+    void dotOff(uint8_t pos);
+
+    // Set/get position for print functions
+    void setPrintPos(uint8_t pos);
+    uint8_t getPrintPos();
+
+    // Write
+    void setSegmentsDigit(uint8_t pos, uint8_t segments);
+    void setDigit(uint8_t pos, uint8_t digit);
+
+    // Display unsigned 32-bit value with optional padding. The default number
+    // of digits is the display width from the print position.
+    void print(unsigned long value);
+    void print(unsigned long value, uint8_t radius);
+    void print(unsigned long value, uint8_t radius, uint8_t maxDigits);
+    void print(unsigned long value, uint8_t radius, uint8_t maxDigits, uint8_t pad);
+
+    // Display signed 32-bit value
+    void print(long value);
+    void print(long value, uint8_t radius);
+    void print(long value, uint8_t radius, uint8_t maxDigits);
+
+protected:
+    LKM1638Board *_boards;      //!< Boards, 0 is most right
+    uint8_t _numBoards;         //!< Number of boards
+    uint8_t _pos;               //!< Print position
+    uint8_t _pollBoard;         //!< Board written by poll()
+
+    void writeUnsignedValue(uint32_t value, uint8_t radius, uint8_t maxDigits,
+                            uint8_t pad);
+    void writeSignedValue(int32_t value, uint8_t radius, uint8_t maxDigits);
+    LKM1638Board *findDigit(uint8_t *pos);
+    void writeDigits(const uint8_t *digits, uint8_t numDigits, uint8_t maxDigits,
+                     uint8_t pad);
+    void displayOverflow(uint8_t numDigits);
+    uint8_t getMaxDigits();
+};
+
+#endif // ERRIEZ_LKM1638_CHAIN_H_
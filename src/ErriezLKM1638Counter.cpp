@@ -0,0 +1,286 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Counter.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include "ErriezLKM1638Counter.h"
+
+/*!
+ * \brief LKM1638Counter constructor for decimal values
+ * \param board LKM1638 board
+ * \param pos Most right digit of the field 0..7
+ * \param numDigits Number of digits of the field
+ */
+LKM1638Counter::LKM1638Counter(LKM1638Board &board, uint8_t pos, uint8_t numDigits) :
+        _board(board)
+{
+    init(pos, numDigits, DEC, 1);
+}
+
+/*!
+ * \brief LKM1638Counter constructor
+ * \param board LKM1638 board
+ * \param pos Most right digit of the field 0..7
+ * \param numDigits Number of digits of the field
+ * \param radius Radius 2 for binary, 10 for decimal, 16 for HEX
+ */
+LKM1638Counter::LKM1638Counter(LKM1638Board &board, uint8_t pos, uint8_t numDigits,
+                               uint8_t radius) :
+        _board(board)
+{
+    init(pos, numDigits, radius, 1);
+}
+
+/*!
+ * \brief LKM1638Counter constructor with leading zeros
+ * \param board LKM1638 board
+ * \param pos Most right digit of the field 0..7
+ * \param numDigits Number of digits of the field
+ * \param radius Radius 2 for binary, 10 for decimal, 16 for HEX
+ * \param pad Minimum number of digits, padded with leading zeros
+ */
+LKM1638Counter::LKM1638Counter(LKM1638Board &board, uint8_t pos, uint8_t numDigits,
+                               uint8_t radius, uint8_t pad) :
+        _board(board)
+{
+    init(pos, numDigits, radius, pad);
+}
+
+//------------------------------------------------------------------------------
+// Set/get value
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set value and write all digits of the field
+ * \details
+ *      Call this function after LKM1638Board::begin() to display the initial
+ *      value.
+ * \param value Value
+ */
+void LKM1638Counter::set(unsigned long value)
+{
+    _value = value;
+
+    render();
+}
+
+/*!
+ * \brief Get value
+ * \return Value, also when it does not fit in the field
+ */
+unsigned long LKM1638Counter::get()
+{
+    return _value;
+}
+
+/*!
+ * \brief Check if the value does not fit in the field
+ * \retval true Overflow displayed
+ * \retval false Value displayed
+ */
+bool LKM1638Counter::isOverflow()
+{
+    return (_value > _maxValue);
+}
+
+//------------------------------------------------------------------------------
+// Count
+//------------------------------------------------------------------------------
+/*!
+ * \brief Increment value by one
+ * \details
+ *      Only the digits which changed by the carry are written. Overflow is
+ *      displayed as minus characters in the field.
+ */
+void LKM1638Counter::increment()
+{
+    uint8_t i = 0;
+
+    _value++;
+
+    if (!_displayed || (_value > _maxValue) || (_value == 0)) {
+        // Overflow, recover from overflow, or first write
+        render();
+        return;
+    }
+
+    // Propagate carry
+    while (_digits[i] == (_radius - 1)) {
+        _digits[i++] = 0;
+    }
+    _digits[i]++;
+
+    if (i >= _used) {
+        _used = (uint8_t)(i + 1);
+    }
+
+    writeDigits((uint8_t)(i + 1));
+}
+
+/*!
+ * \brief Decrement value by one
+ * \details
+ *      Only the digits which changed by the borrow are written. Decrementing
+ *      0 wraps around and displays overflow.
+ */
+void LKM1638Counter::decrement()
+{
+    uint8_t i = 0;
+
+    _value--;
+
+    if (!_displayed || (_value >= _maxValue)) {
+        // Underflow, recover from overflow, or first write
+        render();
+        return;
+    }
+
+    // Propagate borrow
+    while (_digits[i] == 0) {
+        _digits[i++] = (uint8_t)(_radius - 1);
+    }
+    _digits[i]--;
+
+    // Blank most significant zero digit
+    if ((i == (_used - 1)) && (_digits[i] == 0) && (_used > 1)) {
+        _used--;
+    }
+
+    writeDigits((uint8_t)(i + 1));
+}
+
+/*!
+ * \brief Add a positive or negative value
+ * \details
+ *      Steps of one use the carry propagation of increment() and decrement(),
+ *      other steps convert the new value.
+ * \param n Value to add
+ */
+void LKM1638Counter::add(long n)
+{
+    if (n == 1) {
+        increment();
+    } else if (n == -1) {
+        decrement();
+    } else if (n != 0) {
+        set(_value + (unsigned long)n);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Private functions
+//------------------------------------------------------------------------------
+/*!
+ * \brief Initialize counter field
+ * \param pos Most right digit of the field 0..7
+ * \param numDigits Number of digits of the field
+ * \param radius Radius 2..16
+ * \param pad Minimum number of digits
+ */
+void LKM1638Counter::init(uint8_t pos, uint8_t numDigits, uint8_t radius, uint8_t pad)
+{
+    uint8_t boardDigits = _board.getNumDigits();
+
+    if (pos >= boardDigits) {
+        pos = (uint8_t)(boardDigits - 1);
+    }
+    if ((numDigits == 0) || ((pos + numDigits) > boardDigits)) {
+        numDigits = (uint8_t)(boardDigits - pos);
+    }
+    if ((radius < 2) || (radius > 16)) {
+        radius = DEC;
+    }
+
+    _pos = pos;
+    _numDigits = numDigits;
+    _radius = radius;
+    _pad = pad;
+    _used = 0;
+    _value = 0;
+    _displayed = false;
+
+    // Largest value which fits in the field, saturated to 32-bit
+    _maxValue = 1;
+    for (uint8_t i = 0; i < numDigits; i++) {
+        if (_maxValue > (0xFFFFFFFFUL / radius)) {
+            _maxValue = 0;
+            break;
+        }
+        _maxValue *= radius;
+    }
+    _maxValue--;
+}
+
+/*!
+ * \brief Convert value and write all digits of the field
+ */
+void LKM1638Counter::render()
+{
+    uint8_t segments[LKM1638_MAX_DIGITS];
+
+    if (_value > _maxValue) {
+        // Display minus chars in the field, same as LKM1638Board::print()
+        for (uint8_t i = 0; i < _numDigits; i++) {
+            segments[i] = SEGMENTS_MINUS;
+        }
+        _board.setSegmentsDigits(_pos, segments, _numDigits);
+        _displayed = false;
+        return;
+    }
+
+    _used = LKM1638Board::formatDigits(_value, _radius, _digits, _numDigits);
+    for (uint8_t i = _used; i < _numDigits; i++) {
+        _digits[i] = 0;
+    }
+    _displayed = true;
+
+    writeDigits(_numDigits);
+}
+
+/*!
+ * \brief Write the least significant digits
+ * \details
+ *      Digits above the significant digits and the padding are blanked.
+ * \param numDigits Number of digits to write
+ */
+void LKM1638Counter::writeDigits(uint8_t numDigits)
+{
+    uint8_t segments[LKM1638_MAX_DIGITS];
+
+    for (uint8_t i = 0; i < numDigits; i++) {
+        if ((i < _used) || (i < _pad)) {
+            segments[i] = LKM1638Board::getDigitSegments(_digits[i]);
+        } else {
+            segments[i] = SEGMENTS_OFF;
+        }
+    }
+
+    _board.setSegmentsDigits(_pos, segments, numDigits);
+}
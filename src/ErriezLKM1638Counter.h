@@ -0,0 +1,85 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Counter.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_COUNTER_H_
+#define ERRIEZ_LKM1638_COUNTER_H_
+
+#include "ErriezLKM1638Platform.h"
+
+#include "ErriezLKM1638Board.h"
+
+/*!
+ * \brief LKM1638Counter class
+ * \details
+ *      Unsigned counter in a field of digits. The digits are kept in RAM, so
+ *      increment() and decrement() propagate the carry and write only the
+ *      digits which changed, without converting the complete value.
+ */
+class LKM1638Counter
+{
+public:
+    // Constructor
+    LKM1638Counter(LKM1638Board &board, uint8_t pos, uint8_t numDigits);
+    LKM1638Counter(LKM1638Board &board, uint8_t pos, uint8_t numDigits,
+                   uint8_t radius);
+    LKM1638Counter(LKM1638Board &board, uint8_t pos, uint8_t numDigits,
+                   uint8_t radius, uint8_t pad);
+
+    // Set/get value
+    void set(unsigned long value);
+    unsigned long get();
+    bool isOverflow();
+
+    // Count
+    void increment();
+    void decrement();
+    void add(long n);
+
+protected:
+    LKM1638Board &_board;           //!< Board
+    uint8_t _pos;                   //!< Most right digit of the field
+    uint8_t _numDigits;             //!< Number of digits of the field
+    uint8_t _radius;                //!< Radius 2..16
+    uint8_t _pad;                   //!< Minimum number of digits with leading zeros
+    uint8_t _digits[LKM1638_MAX_DIGITS]; //!< Digits, least significant digit first
+    uint8_t _used;                  //!< Number of significant digits
+    unsigned long _value;           //!< Value
+    unsigned long _maxValue;        //!< Maximum value which fits in the field
+    bool _displayed;                //!< Digits valid and written to the board
+
+    void init(uint8_t pos, uint8_t numDigits, uint8_t radius, uint8_t pad);
+    void render();
+    void writeDigits(uint8_t numDigits);
+};
+
+#endif // ERRIEZ_LKM1638_COUNTER_H_
@@ -0,0 +1,248 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Dimmer.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include "ErriezLKM1638Dimmer.h"
+
+/*!
+ * \brief LKM1638Dimmer constructor
+ * \param board LKM1638 board
+ */
+LKM1638Dimmer::LKM1638Dimmer(LKM1638Board &board) :
+        _board(board), _phase(0), _intervalUs(DIMMER_SUBFRAME_US), _byteUs(0),
+        _lastSubframeUs(0), _running(false)
+{
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        _levels[address] = DIMMER_SUBFRAMES;
+        _hw[address] = 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Start and stop dimming
+//------------------------------------------------------------------------------
+/*!
+ * \brief Start dimming
+ * \details
+ *      Call this function after LKM1638Board::begin(). The board is switched
+ *      to buffered mode: all display and LED functions update the shadow
+ *      registers and poll() writes them dimmed. Do not call flush() or
+ *      LKM1638Board::poll() while dimming.
+ */
+void LKM1638Dimmer::begin()
+{
+    _board.setBuffered(true);
+
+    // Write all registers on the first sub-frame
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        _hw[address] = (uint8_t)~_board.getRegister(address);
+    }
+
+    _phase = 0;
+    _lastSubframeUs = micros();
+    _running = true;
+}
+
+/*!
+ * \brief Stop dimming, all registers are written at full brightness
+ */
+void LKM1638Dimmer::end()
+{
+    uint8_t regs[NUM_REGISTERS];
+
+    if (!_running) {
+        return;
+    }
+    _running = false;
+
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        regs[address] = _board.getRegister(address);
+        _hw[address] = regs[address];
+    }
+
+    // One burst, the board has no changes left to flush
+    _board.writeImage(regs, 0xFFFF);
+    _board.setBuffered(false);
+}
+
+//------------------------------------------------------------------------------
+// Brightness levels
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set brightness level of a digit including its dot
+ * \param pos Position 0..7
+ * \param level 0 (off) .. DIMMER_SUBFRAMES (full brightness, default)
+ */
+void LKM1638Dimmer::setDigitLevel(uint8_t pos, uint8_t level)
+{
+    if (pos < _board.getNumDigits()) {
+        _levels[_board.getDigitAddress(pos)] =
+                (level > DIMMER_SUBFRAMES) ? DIMMER_SUBFRAMES : level;
+    }
+}
+
+/*!
+ * \brief Set brightness level of a dual color LED
+ * \param led LED 0..7
+ * \param level 0 (off) .. DIMMER_SUBFRAMES (full brightness, default)
+ */
+void LKM1638Dimmer::setColorLEDLevel(uint8_t led, uint8_t level)
+{
+    if (led < _board.getNumColorLEDs()) {
+        _levels[_board.getColorLEDAddress(led)] =
+                (level > DIMMER_SUBFRAMES) ? DIMMER_SUBFRAMES : level;
+    }
+}
+
+/*!
+ * \brief Set sub-frame interval
+ * \details
+ *      A frame takes DIMMER_SUBFRAMES sub-frames. Use an interval which results
+ *      in at least 100 frames per second to avoid flicker.
+ * \param intervalUs Time in us between two sub-frames
+ */
+void LKM1638Dimmer::setSubframeInterval(uint16_t intervalUs)
+{
+    _intervalUs = intervalUs;
+}
+
+//------------------------------------------------------------------------------
+// Render sub-frames
+//------------------------------------------------------------------------------
+/*!
+ * \brief Write the next sub-frame when the sub-frame interval elapsed
+ * \details
+ *      Call this function from loop() as often as possible.
+ * \retval true Sub-frame written
+ * \retval false No change
+ */
+bool LKM1638Dimmer::poll()
+{
+    unsigned long now = micros();
+
+    // Do not display an incomplete update
+    if (!_running || _board.isUpdating() || ((now - _lastSubframeUs) < _intervalUs)) {
+        return false;
+    }
+    _lastSubframeUs = now;
+
+    renderSubframe();
+
+    return true;
+}
+
+/*!
+ * \brief Get achievable refresh rate
+ * \details
+ *      Based on the measured bus speed and the worst case sub-frame, a burst
+ *      of 16 registers, or the sub-frame interval when that is longer.
+ * \return Frames per second, 0 when not measured yet
+ */
+uint16_t LKM1638Dimmer::getRefreshRate()
+{
+    unsigned long subframeUs;
+
+    if (_byteUs == 0) {
+        return 0;
+    }
+
+    subframeUs = (unsigned long)_byteUs * (2 + NUM_REGISTERS);
+    if (subframeUs < _intervalUs) {
+        subframeUs = _intervalUs;
+    }
+
+    return (uint16_t)(1000000UL / (subframeUs * DIMMER_SUBFRAMES));
+}
+
+//------------------------------------------------------------------------------
+// Private functions
+//------------------------------------------------------------------------------
+/*!
+ * \brief Write registers which changed in the next sub-frame
+ */
+void LKM1638Dimmer::renderSubframe()
+{
+    uint8_t regs[NUM_REGISTERS];
+    uint16_t changed = 0;
+    uint16_t plan;
+    unsigned long startUs;
+    unsigned long byteUs;
+    uint8_t numBytes;
+
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        // Shift phase per register to spread the changes over the sub-frames
+        uint8_t phase = (uint8_t)((_phase + address) % DIMMER_SUBFRAMES);
+        uint8_t level = _levels[address];
+
+        // On in level out of DIMMER_SUBFRAMES evenly spread sub-frames
+        if ((((phase + 1) * level) / DIMMER_SUBFRAMES) != ((phase * level) / DIMMER_SUBFRAMES)) {
+            regs[address] = _board.getRegister(address);
+        } else {
+            regs[address] = 0x00;
+        }
+
+        if (regs[address] != _hw[address]) {
+            changed |= (uint16_t)(1U << address);
+        }
+    }
+
+    _phase = (uint8_t)((_phase + 1) % DIMMER_SUBFRAMES);
+
+    // All changes of the shadow registers are displayed
+    if (changed == 0) {
+        _board.writeImage(regs, 0);
+        return;
+    }
+
+    // Cheapest writes, counted in Bytes
+    plan = LKM1638Board::planWrites(changed, 1, 0);
+    numBytes = (uint8_t)LKM1638Board::getPlanCost(plan, 1, 0);
+
+    for (uint8_t address = 0; address < NUM_REGISTERS; address++) {
+        if (plan & (1U << address)) {
+            _hw[address] = regs[address];
+        }
+    }
+
+    startUs = micros();
+    _board.writeImage(regs, plan);
+
+    // Update average duration of one Byte
+    byteUs = (micros() - startUs) / numBytes;
+    if (byteUs > 0xFFFF) {
+        byteUs = 0xFFFF;
+    }
+    if (_byteUs != 0) {
+        byteUs = (_byteUs + byteUs + 1) / 2;
+    }
+    _byteUs = (byteUs == 0) ? 1 : (uint16_t)byteUs;
+}
@@ -0,0 +1,83 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Dimmer.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_DIMMER_H_
+#define ERRIEZ_LKM1638_DIMMER_H_
+
+#include "ErriezLKM1638Platform.h"
+
+#include "ErriezLKM1638Board.h"
+
+#define DIMMER_SUBFRAMES        4       //!< Sub-frames per frame, maximum level
+#define DIMMER_SUBFRAME_US      2500    //!< Default sub-frame interval
+
+/*!
+ * \brief LKM1638Dimmer class
+ * \details
+ *      Dims digits and dual color LED's individually by turning them on in
+ *      level out of DIMMER_SUBFRAMES sub-frames. Every sub-frame writes only
+ *      the registers which change, with at most one burst of 16 registers.
+ */
+class LKM1638Dimmer
+{
+public:
+    // Constructor
+    explicit LKM1638Dimmer(LKM1638Board &board);
+
+    // Start and stop dimming
+    void begin();
+    void end();
+
+    // Brightness levels
+    void setDigitLevel(uint8_t pos, uint8_t level);
+    void setColorLEDLevel(uint8_t led, uint8_t level);
+    void setSubframeInterval(uint16_t intervalUs);
+
+    // Render sub-frames
+    bool poll();
+    uint16_t getRefreshRate();
+
+protected:
+    LKM1638Board &_board;               //!< Board
+    uint8_t _levels[NUM_REGISTERS];     //!< Level of every register
+    uint8_t _hw[NUM_REGISTERS];         //!< Registers on the board
+    uint8_t _phase;                     //!< Sub-frame 0..DIMMER_SUBFRAMES-1
+    uint16_t _intervalUs;               //!< Sub-frame interval
+    uint16_t _byteUs;                   //!< Average duration of one bus Byte
+    unsigned long _lastSubframeUs;      //!< Time of the last sub-frame
+    bool _running;                      //!< Dimming
+
+    void renderSubframe();
+};
+
+#endif // ERRIEZ_LKM1638_DIMMER_H_
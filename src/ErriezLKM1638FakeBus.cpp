@@ -0,0 +1,215 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638FakeBus.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include <string.h>
+
+#include "ErriezLKM1638FakeBus.h"
+
+/*!
+ * \brief LKM1638FakeBus constructor
+ */
+LKM1638FakeBus::LKM1638FakeBus() :
+        _keys(0), _autoIncrement(true), _displayOn(false), _brightness(0),
+        _active(false), _numFrames(0), _numBytes(0)
+{
+    memset(_regs, 0, sizeof(_regs));
+}
+
+//------------------------------------------------------------------------------
+// LKM1638Bus interface
+//------------------------------------------------------------------------------
+/*!
+ * \brief Initialize bus
+ */
+void LKM1638FakeBus::begin()
+{
+    _active = true;
+}
+
+/*!
+ * \brief Release bus
+ */
+void LKM1638FakeBus::end()
+{
+    _active = false;
+}
+
+/*!
+ * \brief Decode one STB frame
+ * \param data Command and data Bytes
+ * \param len Number of Bytes
+ */
+void LKM1638FakeBus::write(const uint8_t *data, uint8_t len)
+{
+    uint8_t command;
+
+    if (len == 0) {
+        return;
+    }
+
+    _numFrames++;
+    _numBytes += len;
+
+    command = data[0];
+    if ((command & 0xC0) == LKM1638_BUS_WRITE_AUTO) {
+        // Data command
+        _autoIncrement = ((command & 0x04) == 0);
+    } else if ((command & 0xC0) == LKM1638_BUS_DISPLAY) {
+        // Display control command
+        _displayOn = ((command & LKM1638_BUS_DISPLAY_ON) != 0);
+        _brightness = (uint8_t)(command & 0x07);
+    } else if ((command & 0xC0) == LKM1638_BUS_ADDRESS) {
+        // Address command followed by register data
+        uint8_t address = (uint8_t)(command & 0x0F);
+
+        for (uint8_t i = 1; i < len; i++) {
+            _regs[address] = data[i];
+            if (_autoIncrement) {
+                address = (uint8_t)((address + 1) & 0x0F);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Read key-scan registers
+ * \param command LKM1638_BUS_READ_KEYS, other commands read zeros
+ * \param data Buffer for the read Bytes
+ * \param len Number of Bytes to read
+ */
+void LKM1638FakeBus::read(uint8_t command, uint8_t *data, uint8_t len)
+{
+    _numFrames++;
+    _numBytes += (uint32_t)len + 1;
+
+    for (uint8_t i = 0; i < len; i++) {
+        if ((command == LKM1638_BUS_READ_KEYS) && (i < 4)) {
+            data[i] = (uint8_t)(_keys >> (i * 8));
+        } else {
+            data[i] = 0;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Simulated buttons
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set key-scan registers returned by the next reads
+ * \param keys Key-scan registers, BYTE1 in bits 0..7
+ */
+void LKM1638FakeBus::setKeys(uint32_t keys)
+{
+    _keys = keys;
+}
+
+//------------------------------------------------------------------------------
+// TM1638 state
+//------------------------------------------------------------------------------
+/*!
+ * \brief Get display register
+ * \param address Address 0x00..0x0F
+ * \return Register value
+ */
+uint8_t LKM1638FakeBus::getRegister(uint8_t address)
+{
+    return _regs[address & 0x0F];
+}
+
+/*!
+ * \brief Get all display registers
+ * \return 16 registers, index 0 is address 0x00
+ */
+const uint8_t *LKM1638FakeBus::getRegisters()
+{
+    return _regs;
+}
+
+/*!
+ * \brief Get display on/off
+ * \retval true Display on
+ * \retval false Display off
+ */
+bool LKM1638FakeBus::isDisplayOn()
+{
+    return _displayOn;
+}
+
+/*!
+ * \brief Get brightness
+ * \return Brightness 0..7
+ */
+uint8_t LKM1638FakeBus::getBrightness()
+{
+    return _brightness;
+}
+
+/*!
+ * \brief Check if the bus is initialized
+ * \retval true Between begin() and end()
+ * \retval false Not initialized
+ */
+bool LKM1638FakeBus::isActive()
+{
+    return _active;
+}
+
+//------------------------------------------------------------------------------
+// Bus traffic
+//------------------------------------------------------------------------------
+/*!
+ * \brief Get number of STB frames
+ * \return Frames since construction or resetCounters()
+ */
+uint32_t LKM1638FakeBus::getNumFrames()
+{
+    return _numFrames;
+}
+
+/*!
+ * \brief Get number of Bytes
+ * \return Bytes since construction or resetCounters(), including commands
+ */
+uint32_t LKM1638FakeBus::getNumBytes()
+{
+    return _numBytes;
+}
+
+/*!
+ * \brief Reset frame and Byte counters
+ */
+void LKM1638FakeBus::resetCounters()
+{
+    _numFrames = 0;
+    _numBytes = 0;
+}
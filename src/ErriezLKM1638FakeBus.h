@@ -0,0 +1,84 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638FakeBus.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_FAKE_BUS_H_
+#define ERRIEZ_LKM1638_FAKE_BUS_H_
+
+#include "ErriezLKM1638Bus.h"
+
+/*!
+ * \brief LKM1638FakeBus class
+ * \details
+ *      In-memory TM1638 without hardware. Decodes the written frames into 16
+ *      display registers, display on/off and brightness, and returns the key
+ *      state set by the application. Counts frames and Bytes.
+ */
+class LKM1638FakeBus : public LKM1638Bus
+{
+public:
+    // Constructor
+    LKM1638FakeBus();
+
+    // LKM1638Bus interface
+    virtual void begin();
+    virtual void end();
+    virtual void write(const uint8_t *data, uint8_t len);
+    virtual void read(uint8_t command, uint8_t *data, uint8_t len);
+
+    // Simulated buttons, BYTE1 in bits 0..7
+    void setKeys(uint32_t keys);
+
+    // TM1638 state
+    uint8_t getRegister(uint8_t address);
+    const uint8_t *getRegisters();
+    bool isDisplayOn();
+    uint8_t getBrightness();
+    bool isActive();
+
+    // Bus traffic
+    uint32_t getNumFrames();
+    uint32_t getNumBytes();
+    void resetCounters();
+
+protected:
+    uint8_t _regs[16];          //!< Display registers
+    uint32_t _keys;             //!< Key-scan registers
+    bool _autoIncrement;        //!< Address mode of the last data command
+    bool _displayOn;            //!< Display on
+    uint8_t _brightness;        //!< Brightness 0..7
+    bool _active;               //!< Between begin() and end()
+    uint32_t _numFrames;        //!< Number of STB frames
+    uint32_t _numBytes;         //!< Number of Bytes
+};
+
+#endif // ERRIEZ_LKM1638_FAKE_BUS_H_
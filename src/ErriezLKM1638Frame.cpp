@@ -0,0 +1,342 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Frame.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include "ErriezLKM1638Frame.h"
+
+/*!
+ * \brief LKM1638Frame constructor, all LED's off
+ */
+LKM1638Frame::LKM1638Frame() :
+        _numDigits(NUM_DIGITS), _numColorLeds(NUM_COLOR_LEDS)
+{
+    clear();
+}
+
+/*!
+ * \brief LKM1638Frame constructor for a board with less digits or LED's
+ * \param numDigits Number of digits 1..LKM1638_MAX_DIGITS
+ * \param numColorLeds Number of dual color LED's 0..LKM1638_MAX_COLOR_LEDS
+ */
+LKM1638Frame::LKM1638Frame(uint8_t numDigits, uint8_t numColorLeds) :
+        _numDigits((numDigits > LKM1638_MAX_DIGITS) ? (uint8_t)LKM1638_MAX_DIGITS : numDigits),
+        _numColorLeds((numColorLeds > LKM1638_MAX_COLOR_LEDS) ?
+                      (uint8_t)LKM1638_MAX_COLOR_LEDS : numColorLeds)
+{
+    clear();
+}
+
+//------------------------------------------------------------------------------
+// Register image
+//------------------------------------------------------------------------------
+/*!
+ * \brief Turn all LED's off
+ */
+void LKM1638Frame::clear()
+{
+    memset(_regs, 0, NUM_REGISTERS);
+}
+
+/*!
+ * \brief Get register image
+ * \return 16 registers, index 0 is address 0x00
+ */
+uint8_t *LKM1638Frame::getRegisters()
+{
+    return _regs;
+}
+
+/*!
+ * \brief Get register image
+ * \return 16 registers, index 0 is address 0x00
+ */
+const uint8_t *LKM1638Frame::getRegisters() const
+{
+    return _regs;
+}
+
+//------------------------------------------------------------------------------
+// Digits and dots
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set LED segments of a digit, the dot is not changed
+ * \param pos Position 0..7
+ * \param segments Segment LED's, bit 7 is ignored
+ */
+void LKM1638Frame::setSegmentsDigit(uint8_t pos, uint8_t segments)
+{
+    if (pos < _numDigits) {
+        uint8_t *reg = &_regs[getDigitAddress(pos)];
+
+        *reg = (uint8_t)((*reg & 0x80) | (segments & 0x7F));
+    }
+}
+
+/*!
+ * \brief Set digit 0..F, the dot is not changed
+ * \param pos Position 0..7
+ * \param digit Digit 0..15
+ */
+void LKM1638Frame::setDigit(uint8_t pos, uint8_t digit)
+{
+    setSegmentsDigit(pos, LKM1638Board::getDigitSegments(digit));
+}
+
+/*!
+ * \brief Turn dot on
+ * \param pos Position 0..7
+ */
+void LKM1638Frame::dotOn(uint8_t pos)
+{
+    if (pos < _numDigits) {
+        _regs[getDigitAddress(pos)] |= 0x80;
+    }
+}
+
+/*!
+ * \brief Turn dot off
+ * \param pos Position 0..7
+ */
+void LKM1638Frame::dotOff(uint8_t pos)
+{
+    if (pos < _numDigits) {
+        _regs[getDigitAddress(pos)] &= 0x7F;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Dual color LED's
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set dual color LED
+ * \param led LED number (0 = most right)
+ * \param color LedOff, LedRed or LedGreen
+ */
+void LKM1638Frame::setColorLED(uint8_t led, LedColor color)
+{
+    if (led < _numColorLeds) {
+        _regs[getColorLEDAddress(led)] = (uint8_t)(color & 0x03);
+    }
+}
+
+/*!
+ * \brief Set all dual color LED's, red has priority
+ * \param redLeds Byte with LED's to turn red
+ * \param greenLeds Byte with LED's to turn green
+ */
+void LKM1638Frame::setColorLEDs(uint8_t redLeds, uint8_t greenLeds)
+{
+    for (uint8_t led = 0; led < _numColorLeds; led++) {
+        uint8_t data = LedOff;
+
+        if (redLeds & (1 << led)) {
+            data = LedRed;
+        } else if (greenLeds & (1 << led)) {
+            data = LedGreen;
+        }
+        _regs[getColorLEDAddress(led)] = data;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Render value or text
+//------------------------------------------------------------------------------
+/*!
+ * \brief Render unsigned value
+ * \details
+ *      Unused digits in maxDigits are turned off. Minus chars are rendered
+ *      when the value does not fit.
+ * \param pos Most right digit 0..7
+ * \param value Value
+ * \param radius Radius 2 for binary, 10 for decimal, 16 for HEX
+ * \param maxDigits Maximum number of digits
+ * \param pad Minimum number of digits with leading zeros
+ */
+void LKM1638Frame::print(uint8_t pos, unsigned long value, uint8_t radius,
+                         uint8_t maxDigits, uint8_t pad)
+{
+    renderNumber(pos, (uint32_t)value, false, false, radius, maxDigits, pad, 0);
+}
+
+/*!
+ * \brief Render signed value
+ * \details
+ *      A digit for the minus char is reserved, also for positive values, like
+ *      LKM1638Board::print().
+ * \param pos Most right digit 0..7
+ * \param value Value
+ * \param radius Radius 2 for binary, 10 for decimal, 16 for HEX
+ * \param maxDigits Maximum number of digits including minus char
+ */
+void LKM1638Frame::print(uint8_t pos, long value, uint8_t radius, uint8_t maxDigits)
+{
+    uint32_t absValue = (value < 0) ? (uint32_t)0 - (uint32_t)value : (uint32_t)value;
+
+    renderNumber(pos, absValue, (value < 0), true, radius, maxDigits, 1, 0);
+}
+
+/*!
+ * \brief Render fixed point value with decimal point
+ * \param pos Most right digit 0..7
+ * \param value Value multiplied by 10^fracDigits
+ * \param fracDigits Number of digits right of the decimal point
+ * \param maxDigits Maximum number of digits including minus char
+ */
+void LKM1638Frame::printFixed(uint8_t pos, long value, uint8_t fracDigits,
+                              uint8_t maxDigits)
+{
+    uint32_t absValue = (value < 0) ? (uint32_t)0 - (uint32_t)value : (uint32_t)value;
+
+    renderNumber(pos, absValue, (value < 0), (value < 0), DEC, maxDigits, 1, fracDigits);
+}
+
+/*!
+ * \brief Render text
+ * \details
+ *      The last character is rendered at pos. A '.' is rendered in the dot of
+ *      the previous character. Characters which do not fit on the left are
+ *      clipped.
+ * \param pos Most right digit 0..7
+ * \param text Text in RAM
+ */
+void LKM1638Frame::print(uint8_t pos, const char *text)
+{
+    uint8_t segments[LKM1638_MAX_DIGITS];
+    uint8_t numChars = 0;
+    uint8_t maxChars;
+
+    if (pos >= _numDigits) {
+        return;
+    }
+    maxChars = (uint8_t)(_numDigits - pos);
+
+    for (; *text != '\0'; text++) {
+        if ((*text == '.') && (numChars > 0) && !(segments[numChars - 1] & 0x80)) {
+            segments[numChars - 1] |= 0x80;
+        } else if (numChars < maxChars) {
+            segments[numChars++] = LKM1638Board::getCharSegments(*text);
+        } else {
+            break;
+        }
+    }
+
+    // Most left character at the highest position
+    for (uint8_t i = 0; i < numChars; i++) {
+        _regs[getDigitAddress(pos + numChars - 1 - i)] = segments[i];
+    }
+}
+
+//------------------------------------------------------------------------------
+// Private functions
+//------------------------------------------------------------------------------
+/*!
+ * \brief Render number with optional minus char and decimal point
+ * \param pos Most right digit 0..7
+ * \param absValue Absolute value
+ * \param negative Render minus char
+ * \param minusDigit Reserve a digit for the minus char
+ * \param radius Radius
+ * \param maxDigits Maximum number of digits including minus char
+ * \param pad Minimum number of digits with leading zeros
+ * \param fracDigits Number of digits right of the decimal point
+ */
+void LKM1638Frame::renderNumber(uint8_t pos, uint32_t absValue, bool negative,
+                                bool minusDigit, uint8_t radius, uint8_t maxDigits,
+                                uint8_t pad, uint8_t fracDigits)
+{
+    uint8_t digits[LKM1638_MAX_DIGITS];
+    uint8_t numValueDigits;
+    uint8_t numDigits;
+    bool overflow;
+
+    if (pos >= _numDigits) {
+        return;
+    }
+    if ((pos + maxDigits) > _numDigits) {
+        maxDigits = (uint8_t)(_numDigits - pos);
+    }
+
+    // Padding beyond maxDigits is cut off, like LKM1638Board::print()
+    if (pad > maxDigits) {
+        pad = maxDigits;
+    }
+
+    // Display at least one digit left of the decimal point. At least
+    // fracDigits + 1 digits are needed, which never fit from _numDigits.
+    numValueDigits = LKM1638Board::formatDigits(absValue, radius, digits, _numDigits);
+    numDigits = (numValueDigits > fracDigits) ? numValueDigits : (uint8_t)(fracDigits + 1);
+    if (numDigits < pad) {
+        numDigits = pad;
+    }
+    overflow = (fracDigits >= _numDigits) || (numValueDigits > _numDigits) ||
+               ((numDigits + minusDigit) > maxDigits);
+
+    for (uint8_t i = 0; i < maxDigits; i++) {
+        uint8_t segments;
+
+        if (overflow) {
+            // Overflow
+            segments = SEGMENTS_MINUS;
+        } else if (i < numDigits) {
+            segments = LKM1638Board::getDigitSegments((i < numValueDigits) ? digits[i] : 0);
+            if ((fracDigits > 0) && (i == fracDigits)) {
+                segments |= 0x80;
+            }
+        } else if ((i == numDigits) && negative) {
+            segments = SEGMENTS_MINUS;
+        } else {
+            segments = SEGMENTS_OFF;
+        }
+
+        _regs[getDigitAddress(pos + i)] = segments;
+    }
+}
+
+/*!
+ * \brief Get register address of a digit
+ * \param pos Position (0 = most right)
+ * \return Register address
+ */
+uint8_t LKM1638Frame::getDigitAddress(uint8_t pos)
+{
+    return (uint8_t)((_numDigits - 1 - pos) << 1);
+}
+
+/*!
+ * \brief Get register address of a dual color LED
+ * \param led LED number (0 = most right)
+ * \return Register address
+ */
+uint8_t LKM1638Frame::getColorLEDAddress(uint8_t led)
+{
+    return (uint8_t)(0x01 + ((_numColorLeds - 1 - led) << 1));
+}
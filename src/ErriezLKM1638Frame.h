@@ -0,0 +1,90 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Frame.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_FRAME_H_
+#define ERRIEZ_LKM1638_FRAME_H_
+
+#include "ErriezLKM1638Platform.h"
+
+#include "ErriezLKM1638Board.h"
+
+/*!
+ * \brief LKM1638Frame class
+ * \details
+ *      TM1638 register image of 16 Bytes in RAM. All functions render into
+ *      the image without bus I/O. Write a frame with LKM1638Board::blit() to
+ *      a board with the same number of digits and LED's.
+ */
+class LKM1638Frame
+{
+public:
+    // Constructor for a board with NUM_DIGITS digits and NUM_COLOR_LEDS LED's
+    LKM1638Frame();
+    // Constructor for a board with less digits or LED's
+    LKM1638Frame(uint8_t numDigits, uint8_t numColorLeds);
+
+    // Register image
+    void clear();
+    uint8_t *getRegisters();
+    const uint8_t *getRegisters() const;
+
+    // Digits and dots
+    void setSegmentsDigit(uint8_t pos, uint8_t segments);
+    void setDigit(uint8_t pos, uint8_t digit);
+    void dotOn(uint8_t pos);
+    void dotOff(uint8_t pos);
+
+    // Dual color LED's
+    void setColorLED(uint8_t led, LedColor color);
+    void setColorLEDs(uint8_t redLeds, uint8_t greenLeds);
+
+    // Render value or text, the most right digit at pos
+    void print(uint8_t pos, unsigned long value, uint8_t radius, uint8_t maxDigits,
+               uint8_t pad);
+    void print(uint8_t pos, long value, uint8_t radius, uint8_t maxDigits);
+    void printFixed(uint8_t pos, long value, uint8_t fracDigits, uint8_t maxDigits);
+    void print(uint8_t pos, const char *text);
+
+protected:
+    uint8_t _regs[NUM_REGISTERS];   //!< TM1638 register image
+    uint8_t _numDigits;             //!< Number of digits of the board
+    uint8_t _numColorLeds;          //!< Number of dual color LED's of the board
+
+    uint8_t getDigitAddress(uint8_t pos);
+    uint8_t getColorLEDAddress(uint8_t led);
+
+    void renderNumber(uint8_t pos, uint32_t absValue, bool negative, bool minusDigit,
+                      uint8_t radius, uint8_t maxDigits, uint8_t pad, uint8_t fracDigits);
+};
+
+#endif // ERRIEZ_LKM1638_FRAME_H_
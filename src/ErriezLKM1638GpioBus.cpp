@@ -0,0 +1,144 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638GpioBus.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include "ErriezLKM1638GpioBus.h"
+
+/*!
+ * \brief LKM1638GpioBus constructor
+ * \param gpio GPIO lines
+ */
+LKM1638GpioBus::LKM1638GpioBus(LKM1638Gpio &gpio) :
+        _gpio(gpio)
+{
+}
+
+/*!
+ * \brief Initialize lines, STB and CLK high
+ */
+void LKM1638GpioBus::begin()
+{
+    _gpio.write(LKM1638_GPIO_ALL, LKM1638_GPIO_ALL);
+    _gpio.setInputs(0);
+}
+
+/*!
+ * \brief Release lines
+ */
+void LKM1638GpioBus::end()
+{
+    _gpio.setInputs(LKM1638_GPIO_ALL);
+}
+
+/*!
+ * \brief Write one STB frame
+ * \param data Command and data Bytes
+ * \param len Number of Bytes
+ */
+void LKM1638GpioBus::write(const uint8_t *data, uint8_t len)
+{
+    _gpio.write(LKM1638_GPIO_STB, 0);
+    for (uint8_t i = 0; i < len; i++) {
+        writeByte(data[i]);
+    }
+    _gpio.write(LKM1638_GPIO_STB, LKM1638_GPIO_STB);
+}
+
+/*!
+ * \brief Write a command and read Bytes in one STB frame
+ * \param command Command
+ * \param data Buffer for the read Bytes
+ * \param len Number of Bytes to read
+ */
+void LKM1638GpioBus::read(uint8_t command, uint8_t *data, uint8_t len)
+{
+    _gpio.write(LKM1638_GPIO_STB, 0);
+    writeByte(command);
+    _gpio.setInputs(LKM1638_GPIO_DIO);
+    for (uint8_t i = 0; i < len; i++) {
+        data[i] = readByte();
+    }
+    _gpio.setInputs(0);
+    _gpio.write(LKM1638_GPIO_STB, LKM1638_GPIO_STB);
+}
+
+/*!
+ * \brief Get error of the GPIO lines
+ * \retval true A GPIO call failed
+ * \retval false No error
+ */
+bool LKM1638GpioBus::isError()
+{
+    return _gpio.isError();
+}
+
+/*!
+ * \brief Clear error of the GPIO lines
+ */
+void LKM1638GpioBus::clearError()
+{
+    _gpio.clearError();
+}
+
+/*!
+ * \brief Write Byte, LSB first, data latched on rising clock edge
+ * \param data Byte
+ */
+void LKM1638GpioBus::writeByte(uint8_t data)
+{
+    for (uint8_t i = 0; i < 8; i++) {
+        // Clock low and data bit with one GPIO call
+        _gpio.write(LKM1638_GPIO_CLK | LKM1638_GPIO_DIO,
+                    (data & 0x01) ? LKM1638_GPIO_DIO : 0);
+        _gpio.write(LKM1638_GPIO_CLK, LKM1638_GPIO_CLK);
+        data >>= 1;
+    }
+}
+
+/*!
+ * \brief Read Byte, LSB first, data valid after falling clock edge
+ * \return Byte
+ */
+uint8_t LKM1638GpioBus::readByte()
+{
+    uint8_t data = 0;
+
+    for (uint8_t i = 0; i < 8; i++) {
+        _gpio.write(LKM1638_GPIO_CLK, 0);
+        _gpio.write(LKM1638_GPIO_CLK, LKM1638_GPIO_CLK);
+        if (_gpio.read(LKM1638_GPIO_DIO)) {
+            data |= (uint8_t)(1 << i);
+        }
+    }
+
+    return data;
+}
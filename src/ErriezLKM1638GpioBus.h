@@ -0,0 +1,130 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638GpioBus.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_GPIO_BUS_H_
+#define ERRIEZ_LKM1638_GPIO_BUS_H_
+
+#include "ErriezLKM1638Bus.h"
+
+// GPIO line bits
+#define LKM1638_GPIO_CLK    0x01 //!< Clock line
+#define LKM1638_GPIO_DIO    0x02 //!< Data line (bi-directional)
+#define LKM1638_GPIO_STB    0x04 //!< Strobe line (low is enable)
+#define LKM1638_GPIO_ALL    0x07 //!< All lines
+
+/*!
+ * \brief LKM1638Gpio interface
+ * \details
+ *      Controls the CLK, DIO and STB lines. One call changes multiple lines at
+ *      once. Every call must take at least 400ns, the minimum clock pulse
+ *      width of the TM1638.
+ */
+class LKM1638Gpio
+{
+public:
+    /*!
+     * \brief Destructor
+     */
+    virtual ~LKM1638Gpio() {}
+
+    /*!
+     * \brief Set output lines
+     * \param mask Lines to change, LKM1638_GPIO_CLK, _DIO and/or _STB
+     * \param values New levels of the lines in mask
+     */
+    virtual void write(uint8_t mask, uint8_t values) = 0;
+
+    /*!
+     * \brief Read input lines
+     * \param mask Lines to read
+     * \return Levels of the lines in mask
+     */
+    virtual uint8_t read(uint8_t mask) = 0;
+
+    /*!
+     * \brief Set line directions
+     * \details
+     *      Output lines keep the level of the last write().
+     * \param inputs Input lines, all other lines are outputs
+     */
+    virtual void setInputs(uint8_t inputs) = 0;
+
+    /*!
+     * \brief Get error of the GPIO calls
+     * \retval true A GPIO call failed since begin or clearError()
+     * \retval false No error
+     */
+    virtual bool isError() { return false; }
+
+    /*!
+     * \brief Clear error
+     */
+    virtual void clearError() {}
+};
+
+/*!
+ * \brief LKM1638GpioBus class
+ * \details
+ *      TM1638 bus on a LKM1638Gpio. Every clock edge is one GPIO call, so
+ *      CLK and DIO are changed together only on the falling clock edge:
+ *      - Written Byte: 16 write() calls, 2 per bit.
+ *      - Read Byte: 16 write() and 8 read() calls, 3 per bit.
+ *      - STB frame: 2 write() calls for STB, a read frame 2 setInputs() calls
+ *        more to turn DIO around.
+ *
+ *      A display burst of 17 Bytes is 274 GPIO calls, reading the keys
+ *      (command and 4 Bytes) 116 GPIO calls. On LKM1638LinuxGpio every GPIO
+ *      call is one ioctl() system call.
+ */
+class LKM1638GpioBus : public LKM1638Bus
+{
+public:
+    // Constructor
+    explicit LKM1638GpioBus(LKM1638Gpio &gpio);
+
+    // LKM1638Bus interface
+    virtual void begin();
+    virtual void end();
+    virtual void write(const uint8_t *data, uint8_t len);
+    virtual void read(uint8_t command, uint8_t *data, uint8_t len);
+    virtual bool isError();
+    virtual void clearError();
+
+protected:
+    LKM1638Gpio &_gpio;         //!< GPIO lines
+
+    void writeByte(uint8_t data);
+    uint8_t readByte();
+};
+
+#endif // ERRIEZ_LKM1638_GPIO_BUS_H_
@@ -0,0 +1,257 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Layout.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include "ErriezLKM1638Layout.h"
+
+/*!
+ * \brief LKM1638Layout constructor
+ * \param board LKM1638 board
+ * \param fields Fields, must remain valid
+ * \param numFields Number of fields 1..8
+ */
+LKM1638Layout::LKM1638Layout(LKM1638Board &board, const LKM1638Field *fields,
+                             uint8_t numFields) :
+        _board(board), _fields(fields), _numFields(numFields), _dots(0),
+        _changed(0)
+{
+    for (uint8_t i = 0; i < MAX_LAYOUT_FIELDS; i++) {
+        _values[i] = 0;
+    }
+    for (uint8_t i = 0; i < LKM1638_MAX_DIGITS; i++) {
+        _segments[i] = SEGMENTS_OFF;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Validate layout
+//------------------------------------------------------------------------------
+/*!
+ * \brief Validate layout
+ * \details
+ *      Fields must fit on the display and must not overlap. All fields are
+ *      written on the next update().
+ * \retval true Layout valid
+ * \retval false Layout invalid, set() and update() have no effect
+ */
+bool LKM1638Layout::begin()
+{
+    uint8_t used = 0;
+
+    if (_numFields > MAX_LAYOUT_FIELDS) {
+        _numFields = 0;
+        return false;
+    }
+
+    for (uint8_t i = 0; i < _numFields; i++) {
+        const LKM1638Field *field = &_fields[i];
+        uint8_t mask;
+
+        if ((field->numDigits == 0) || (field->pos >= _board.getNumDigits()) ||
+            ((field->pos + field->numDigits) > _board.getNumDigits()) ||
+            (field->radius < 2) || (field->radius > 16) ||
+            (field->fracDigits >= field->numDigits)) {
+            _numFields = 0;
+            return false;
+        }
+
+        mask = (uint8_t)(((1U << field->numDigits) - 1) << field->pos);
+        if (used & mask) {
+            _numFields = 0;
+            return false;
+        }
+        used |= mask;
+
+        if (field->flags & FIELD_DOT) {
+            _dots |= (uint8_t)(1 << i);
+        }
+    }
+
+    _changed = (uint8_t)((1U << _numFields) - 1);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Set/get values
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set value of a field
+ * \details
+ *      The value is displayed on the next update().
+ * \param field Field index
+ * \param value Value, multiplied by 10^fracDigits for fixed point fields
+ */
+void LKM1638Layout::set(uint8_t field, long value)
+{
+    if ((field < _numFields) && (_values[field] != value)) {
+        _values[field] = value;
+        _changed |= (uint8_t)(1 << field);
+    }
+}
+
+/*!
+ * \brief Get value of a field
+ * \param field Field index
+ * \return Value
+ */
+long LKM1638Layout::get(uint8_t field)
+{
+    if (field >= _numFields) {
+        return 0;
+    }
+
+    return _values[field];
+}
+
+/*!
+ * \brief Turn dot on the most right digit of a field on or off
+ * \param field Field index
+ * \param on true: Dot on, false: Dot off
+ */
+void LKM1638Layout::setDot(uint8_t field, bool on)
+{
+    uint8_t mask = (uint8_t)(1 << field);
+
+    if ((field < _numFields) && (((_dots & mask) != 0) != on)) {
+        _dots ^= mask;
+        _changed |= mask;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Write changed fields
+//------------------------------------------------------------------------------
+/*!
+ * \brief Render changed fields and write them with one write
+ * \details
+ *      Digits which did not change are not written. Digits between the
+ *      fields are not changed. In buffered mode the changes are written by
+ *      LKM1638Board::flush().
+ * \retval true Fields changed
+ * \retval false No change
+ */
+bool LKM1638Layout::update()
+{
+    if (_changed == 0) {
+        return false;
+    }
+
+    // Collect all fields in the shadow registers and write them at once
+    _board.beginUpdate();
+
+    for (uint8_t i = 0; i < _numFields; i++) {
+        if (_changed & (1 << i)) {
+            const LKM1638Field *field = &_fields[i];
+            uint8_t dots = renderField(i);
+
+            // Dots are kept in the dot state of the board, so dotOff() and
+            // setDots() can still turn them off
+            for (uint8_t d = 0; d < field->numDigits; d++) {
+                if (dots & (1 << d)) {
+                    _board.dotOn((uint8_t)(field->pos + d));
+                } else {
+                    _board.dotOff((uint8_t)(field->pos + d));
+                }
+            }
+            _board.setSegmentsDigits(field->pos, &_segments[field->pos], field->numDigits);
+        }
+    }
+    _changed = 0;
+
+    _board.endUpdate();
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Private functions
+//------------------------------------------------------------------------------
+/*!
+ * \brief Render value of a field
+ * \details
+ *      Minus chars are displayed when the value does not fit in the field.
+ *      The padding is limited to the width of the field.
+ * \param field Field index
+ * \return Dots of the field, bit 0 is the most right digit of the field
+ */
+uint8_t LKM1638Layout::renderField(uint8_t field)
+{
+    const LKM1638Field *f = &_fields[field];
+    uint8_t *segments = &_segments[f->pos];
+    uint8_t digits[LKM1638_MAX_DIGITS];
+    uint8_t numValueDigits;
+    uint8_t numDigits;
+    uint8_t pad;
+    uint8_t dots = 0;
+    uint32_t absValue;
+    long value = _values[field];
+    bool negative = (value < 0);
+
+    absValue = negative ? (uint32_t)0 - (uint32_t)value : (uint32_t)value;
+
+    // Display at least one digit left of the decimal point
+    numValueDigits = LKM1638Board::formatDigits(absValue, f->radius, digits, f->numDigits);
+    numDigits = (numValueDigits > f->fracDigits) ? numValueDigits : (uint8_t)(f->fracDigits + 1);
+    pad = (f->pad < f->numDigits) ? f->pad : f->numDigits;
+    if (numDigits < pad) {
+        numDigits = pad;
+    }
+
+    if ((negative && !(f->flags & FIELD_SIGNED)) ||
+        (numValueDigits > f->numDigits) || ((numDigits + negative) > f->numDigits)) {
+        for (uint8_t i = 0; i < f->numDigits; i++) {
+            segments[i] = SEGMENTS_MINUS;
+        }
+        return 0;
+    }
+
+    for (uint8_t i = 0; i < f->numDigits; i++) {
+        if (i < numDigits) {
+            segments[i] = LKM1638Board::getDigitSegments((i < numValueDigits) ? digits[i] : 0);
+        } else if ((i == numDigits) && negative) {
+            segments[i] = SEGMENTS_MINUS;
+        } else {
+            segments[i] = SEGMENTS_OFF;
+        }
+    }
+
+    // Decimal point right of the units digit
+    if (f->fracDigits > 0) {
+        dots |= (uint8_t)(1 << f->fracDigits);
+    }
+    if (_dots & (1 << field)) {
+        dots |= 0x01;
+    }
+
+    return dots;
+}
@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Layout.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_LAYOUT_H_
+#define ERRIEZ_LKM1638_LAYOUT_H_
+
+#include "ErriezLKM1638Platform.h"
+
+#include "ErriezLKM1638Board.h"
+
+#define MAX_LAYOUT_FIELDS   LKM1638_MAX_DIGITS //!< Maximum number of fields
+
+#define FIELD_SIGNED        0x01    //!< Field displays negative values
+#define FIELD_DOT           0x02    //!< Dot on the most right digit of the field
+
+/*!
+ * \brief Field of a layout
+ */
+typedef struct {
+    uint8_t pos;            //!< Most right digit 0..7
+    uint8_t numDigits;      //!< Number of digits, including minus char
+    uint8_t radius;         //!< Radius 2 for binary, 10 for decimal, 16 for HEX
+    uint8_t pad;            //!< Minimum number of digits with leading zeros, up to numDigits
+    uint8_t fracDigits;     //!< Number of digits right of the decimal point
+    uint8_t flags;          //!< FIELD_SIGNED and FIELD_DOT
+} LKM1638Field;
+
+/*!
+ * \brief LKM1638Layout class
+ * \details
+ *      Displays values in fields which are declared once. The fields are
+ *      validated by begin(), so updating a value does not check the display
+ *      bounds again. All changed fields are written with one write.
+ */
+class LKM1638Layout
+{
+public:
+    // Constructor
+    LKM1638Layout(LKM1638Board &board, const LKM1638Field *fields, uint8_t numFields);
+
+    // Validate layout
+    bool begin();
+
+    // Set/get values
+    void set(uint8_t field, long value);
+    long get(uint8_t field);
+    void setDot(uint8_t field, bool on);
+
+    // Write changed fields
+    bool update();
+
+protected:
+    LKM1638Board &_board;               //!< Board
+    const LKM1638Field *_fields;        //!< Fields
+    uint8_t _numFields;                 //!< Number of valid fields
+    long _values[MAX_LAYOUT_FIELDS];    //!< Field values
+    uint8_t _dots;                      //!< Fields with dot on
+    uint8_t _changed;                   //!< Fields changed since last update
+    uint8_t _segments[LKM1638_MAX_DIGITS]; //!< Rendered digits
+
+    uint8_t renderField(uint8_t field);
+};
+
+#endif // ERRIEZ_LKM1638_LAYOUT_H_
@@ -0,0 +1,231 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638LinuxGpio.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include <fcntl.h>
+#include <linux/gpio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include "ErriezLKM1638LinuxGpio.h"
+
+/*!
+ * \brief LKM1638LinuxGpio constructor
+ * \param chip GPIO chip device, for example "/dev/gpiochip0"
+ * \param clkLine Clock line offset
+ * \param dioLine Data line offset
+ * \param stbLine Strobe line offset
+ */
+LKM1638LinuxGpio::LKM1638LinuxGpio(const char *chip, unsigned int clkLine,
+                                   unsigned int dioLine, unsigned int stbLine) :
+        _chip(chip), _fd(-1), _values(LKM1638_GPIO_ALL), _error(false)
+{
+    // Index in the line request is the bit number of LKM1638_GPIO_xxx
+    _lines[0] = clkLine;
+    _lines[1] = dioLine;
+    _lines[2] = stbLine;
+}
+
+/*!
+ * \brief LKM1638LinuxGpio destructor, releases the lines
+ */
+LKM1638LinuxGpio::~LKM1638LinuxGpio()
+{
+    end();
+}
+
+//------------------------------------------------------------------------------
+// Request and release lines
+//------------------------------------------------------------------------------
+/*!
+ * \brief Request lines as outputs, all high
+ * \details
+ *      Clears the error on success and sets it on failure.
+ * \retval true Success
+ * \retval false Chip cannot be opened or lines are busy
+ */
+bool LKM1638LinuxGpio::begin()
+{
+    struct gpio_v2_line_request request;
+    int chipFd;
+    int ret;
+
+    end();
+
+    _error = true;
+
+    chipFd = open(_chip, O_RDWR | O_CLOEXEC);
+    if (chipFd < 0) {
+        return false;
+    }
+
+    memset(&request, 0, sizeof(request));
+    for (uint8_t i = 0; i < 3; i++) {
+        request.offsets[i] = _lines[i];
+    }
+    request.num_lines = 3;
+    strncpy(request.consumer, "ErriezLKM1638", sizeof(request.consumer) - 1);
+    request.config.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+    request.config.num_attrs = 1;
+    request.config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+    request.config.attrs[0].attr.values = LKM1638_GPIO_ALL;
+    request.config.attrs[0].mask = LKM1638_GPIO_ALL;
+
+    ret = ioctl(chipFd, GPIO_V2_GET_LINE_IOCTL, &request);
+    close(chipFd);
+    if (ret < 0) {
+        return false;
+    }
+
+    _fd = request.fd;
+    _values = LKM1638_GPIO_ALL;
+    _error = false;
+
+    return true;
+}
+
+/*!
+ * \brief Release lines
+ */
+void LKM1638LinuxGpio::end()
+{
+    if (_fd >= 0) {
+        close(_fd);
+        _fd = -1;
+    }
+}
+
+//------------------------------------------------------------------------------
+// LKM1638Gpio interface
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set output lines with one GPIO_V2_LINE_SET_VALUES ioctl
+ * \details
+ *      Called for every clock edge by LKM1638GpioBus.
+ * \param mask Lines to change
+ * \param values New levels of the lines in mask
+ */
+void LKM1638LinuxGpio::write(uint8_t mask, uint8_t values)
+{
+    struct gpio_v2_line_values lineValues;
+
+    _values = (uint8_t)((_values & ~mask) | (values & mask));
+
+    if (_fd < 0) {
+        _error = true;
+        return;
+    }
+
+    lineValues.mask = mask;
+    lineValues.bits = values;
+    if (ioctl(_fd, GPIO_V2_LINE_SET_VALUES_IOCTL, &lineValues) < 0) {
+        _error = true;
+    }
+}
+
+/*!
+ * \brief Read input lines with one GPIO_V2_LINE_GET_VALUES ioctl
+ * \param mask Lines to read
+ * \return Levels of the lines in mask, 0 on error
+ */
+uint8_t LKM1638LinuxGpio::read(uint8_t mask)
+{
+    struct gpio_v2_line_values lineValues;
+
+    if (_fd < 0) {
+        _error = true;
+        return 0;
+    }
+
+    lineValues.mask = mask;
+    lineValues.bits = 0;
+    if (ioctl(_fd, GPIO_V2_LINE_GET_VALUES_IOCTL, &lineValues) < 0) {
+        _error = true;
+        return 0;
+    }
+
+    return (uint8_t)(lineValues.bits & mask);
+}
+
+/*!
+ * \brief Set line directions with one GPIO_V2_LINE_SET_CONFIG ioctl
+ * \param inputs Input lines, all other lines are outputs
+ */
+void LKM1638LinuxGpio::setInputs(uint8_t inputs)
+{
+    struct gpio_v2_line_config config;
+
+    if (_fd < 0) {
+        _error = true;
+        return;
+    }
+
+    memset(&config, 0, sizeof(config));
+    config.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+    config.num_attrs = 2;
+    config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_FLAGS;
+    config.attrs[0].attr.flags = GPIO_V2_LINE_FLAG_INPUT;
+    config.attrs[0].mask = inputs & LKM1638_GPIO_ALL;
+
+    // Outputs keep their level
+    config.attrs[1].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+    config.attrs[1].attr.values = _values;
+    config.attrs[1].mask = (uint8_t)~inputs & LKM1638_GPIO_ALL;
+
+    if (ioctl(_fd, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config) < 0) {
+        _error = true;
+    }
+}
+
+/*!
+ * \brief Get error
+ * \retval true A call failed or was made without requested lines since
+ *      begin() or clearError()
+ * \retval false No error
+ */
+bool LKM1638LinuxGpio::isError()
+{
+    return _error;
+}
+
+/*!
+ * \brief Clear error
+ */
+void LKM1638LinuxGpio::clearError()
+{
+    _error = false;
+}
+
+#endif // __linux__ && !ARDUINO
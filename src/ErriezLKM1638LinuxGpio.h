@@ -0,0 +1,83 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638LinuxGpio.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_LINUX_GPIO_H_
+#define ERRIEZ_LKM1638_LINUX_GPIO_H_
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include "ErriezLKM1638GpioBus.h"
+
+/*!
+ * \brief LKM1638LinuxGpio class
+ * \details
+ *      CLK, DIO and STB lines of a Linux GPIO character device, for example
+ *      /dev/gpiochip0 on a Raspberry Pi. The three lines are requested at
+ *      once, so every write() changes all lines in the mask with one ioctl()
+ *      system call. The character device has no call for a sequence of line
+ *      levels, so every clock edge of LKM1638GpioBus is one system call: 16
+ *      per written Byte and 24 per read Byte, see LKM1638GpioBus.
+ *
+ *      Calls without requested lines and failed ioctl() calls set an error,
+ *      see isError(). begin() clears it.
+ */
+class LKM1638LinuxGpio : public LKM1638Gpio
+{
+public:
+    // Constructor with chip device and line offsets
+    LKM1638LinuxGpio(const char *chip, unsigned int clkLine, unsigned int dioLine,
+                     unsigned int stbLine);
+    virtual ~LKM1638LinuxGpio();
+
+    // Request and release lines
+    bool begin();
+    void end();
+
+    // LKM1638Gpio interface
+    virtual void write(uint8_t mask, uint8_t values);
+    virtual uint8_t read(uint8_t mask);
+    virtual void setInputs(uint8_t inputs);
+    virtual bool isError();
+    virtual void clearError();
+
+protected:
+    const char *_chip;          //!< GPIO chip device
+    unsigned int _lines[3];     //!< Line offsets of CLK, DIO and STB
+    int _fd;                    //!< Line request, -1 when not requested
+    uint8_t _values;            //!< Output levels
+    bool _error;                //!< A call failed or lines not requested
+};
+
+#endif // __linux__ && !ARDUINO
+
+#endif // ERRIEZ_LKM1638_LINUX_GPIO_H_
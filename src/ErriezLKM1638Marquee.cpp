@@ -0,0 +1,215 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Marquee.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include "ErriezLKM1638Marquee.h"
+
+/*!
+ * \brief LKM1638Marquee constructor
+ * \param board LKM1638 board
+ */
+LKM1638Marquee::LKM1638Marquee(LKM1638Board &board) :
+        _board(board), _text(NULL), _flash(false), _length(0), _offset(0),
+        _pos(0), _numDigits(board.getNumDigits()), _intervalMs(MARQUEE_INTERVAL_MS),
+        _lastStepMs(0), _running(false)
+{
+}
+
+//------------------------------------------------------------------------------
+// Configuration
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set digits used for scrolling
+ * \param pos Most right digit 0..7
+ * \param numDigits Number of digits
+ */
+void LKM1638Marquee::setWindow(uint8_t pos, uint8_t numDigits)
+{
+    uint8_t boardDigits = _board.getNumDigits();
+
+    if ((pos < boardDigits) && (numDigits > 0)) {
+        _pos = pos;
+        _numDigits = ((pos + numDigits) > boardDigits) ? (uint8_t)(boardDigits - pos) : numDigits;
+    }
+}
+
+/*!
+ * \brief Set scroll interval
+ * \param intervalMs Time in ms between two steps
+ */
+void LKM1638Marquee::setInterval(uint16_t intervalMs)
+{
+    _intervalMs = intervalMs;
+}
+
+//------------------------------------------------------------------------------
+// Start and stop scrolling
+//------------------------------------------------------------------------------
+/*!
+ * \brief Start scrolling text
+ * \details
+ *      The text must remain valid while scrolling. Text which fits in the
+ *      window is displayed without scrolling.
+ * \param text Text in RAM
+ */
+void LKM1638Marquee::begin(const char *text)
+{
+    start(text, false);
+}
+
+/*!
+ * \brief Start scrolling text from flash
+ * \param text Text in flash, for example F("Hello world")
+ */
+void LKM1638Marquee::begin(const __FlashStringHelper *text)
+{
+    start((const char *)text, true);
+}
+
+/*!
+ * \brief Stop scrolling, the display is not changed
+ */
+void LKM1638Marquee::stop()
+{
+    _running = false;
+}
+
+/*!
+ * \brief Check if text is scrolling
+ * \retval true Scrolling
+ * \retval false Stopped
+ */
+bool LKM1638Marquee::isRunning()
+{
+    return _running;
+}
+
+//------------------------------------------------------------------------------
+// Scroll text
+//------------------------------------------------------------------------------
+/*!
+ * \brief Scroll one step when the interval elapsed
+ * \details
+ *      Call this function from loop() as often as possible.
+ * \retval true Text scrolled
+ * \retval false No change
+ */
+bool LKM1638Marquee::poll()
+{
+    unsigned long now = millis();
+
+    if (!_running || ((now - _lastStepMs) < _intervalMs)) {
+        return false;
+    }
+
+    _lastStepMs = now;
+    step();
+
+    return true;
+}
+
+/*!
+ * \brief Scroll one step
+ * \details
+ *      The text enters on the right and leaves on the left, followed by one
+ *      empty window before it starts again.
+ */
+void LKM1638Marquee::step()
+{
+    if (!_running) {
+        return;
+    }
+
+    if (++_offset > (int16_t)_length) {
+        _offset = (int16_t)(1 - _numDigits);
+    }
+
+    render();
+}
+
+//------------------------------------------------------------------------------
+// Private functions
+//------------------------------------------------------------------------------
+/*!
+ * \brief Start scrolling
+ * \param text Text
+ * \param flash true: Text in flash, false: Text in RAM
+ */
+void LKM1638Marquee::start(const char *text, bool flash)
+{
+    _text = text;
+    _flash = flash;
+    _length = (uint16_t)(flash ? strlen_P(text) : strlen(text));
+    _lastStepMs = millis();
+
+    if (_length <= _numDigits) {
+        // Display text right aligned without scrolling
+        _offset = (int16_t)(_length - _numDigits);
+        _running = false;
+    } else {
+        // First character at the most right digit
+        _offset = (int16_t)(1 - _numDigits);
+        _running = true;
+    }
+
+    render();
+}
+
+/*!
+ * \brief Write the visible characters
+ */
+void LKM1638Marquee::render()
+{
+    uint8_t segments[LKM1638_MAX_DIGITS];
+
+    for (uint8_t i = 0; i < _numDigits; i++) {
+        // Most right digit displays the last visible character
+        segments[i] = LKM1638Board::getCharSegments(
+                getChar((int16_t)(_offset + _numDigits - 1 - i)));
+    }
+
+    _board.setSegmentsDigits(_pos, segments, _numDigits);
+}
+
+/*!
+ * \brief Get character of the text
+ * \param index Character index
+ * \return Character, or space outside the text
+ */
+char LKM1638Marquee::getChar(int16_t index)
+{
+    if ((index < 0) || (index >= (int16_t)_length)) {
+        return ' ';
+    }
+
+    return _flash ? (char)pgm_read_byte(&_text[index]) : _text[index];
+}
@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Marquee.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_MARQUEE_H_
+#define ERRIEZ_LKM1638_MARQUEE_H_
+
+#include "ErriezLKM1638Platform.h"
+
+#include "ErriezLKM1638Board.h"
+
+#define MARQUEE_INTERVAL_MS     300 //!< Default scroll interval
+
+/*!
+ * \brief LKM1638Marquee class
+ * \details
+ *      Scrolls text which does not fit in a window of digits from right to
+ *      left. Every step writes only the digits which changed.
+ */
+class LKM1638Marquee
+{
+public:
+    // Constructor
+    explicit LKM1638Marquee(LKM1638Board &board);
+
+    // Configuration
+    void setWindow(uint8_t pos, uint8_t numDigits);
+    void setInterval(uint16_t intervalMs);
+
+    // Start and stop scrolling
+    void begin(const char *text);
+    void begin(const __FlashStringHelper *text);
+    void stop();
+    bool isRunning();
+
+    // Scroll text
+    bool poll();
+    void step();
+
+protected:
+    LKM1638Board &_board;       //!< Board
+    const char *_text;          //!< Text
+    bool _flash;                //!< Text in flash
+    uint16_t _length;           //!< Number of characters
+    int16_t _offset;            //!< Character at the most left digit
+    uint8_t _pos;               //!< Most right digit of the window
+    uint8_t _numDigits;         //!< Number of digits of the window
+    uint16_t _intervalMs;       //!< Scroll interval
+    unsigned long _lastStepMs;  //!< Time of the last step
+    bool _running;              //!< Scrolling
+
+    void start(const char *text, bool flash);
+    void render();
+    char getChar(int16_t index);
+};
+
+#endif // ERRIEZ_LKM1638_MARQUEE_H_
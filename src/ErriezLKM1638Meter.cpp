@@ -0,0 +1,351 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Meter.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include "ErriezLKM1638Meter.h"
+
+// Red threshold above every range: all LED's green
+#define METER_NO_RED            0x7FFFFFFFL
+
+// Segments of the left and right half of a digit
+#define METER_SEGMENTS_LEFT     0b00110000
+#define METER_SEGMENTS_RIGHT    0b00000110
+
+/*!
+ * \brief LKM1638Meter constructor for the dual color LED's
+ * \param board LKM1638 board
+ */
+LKM1638Meter::LKM1638Meter(LKM1638Board &board) :
+        _board(board)
+{
+    init(MeterLEDs);
+}
+
+/*!
+ * \brief LKM1638Meter constructor
+ * \param board LKM1638 board
+ * \param mode MeterLEDs or MeterSegments
+ */
+LKM1638Meter::LKM1638Meter(LKM1638Board &board, MeterMode mode) :
+        _board(board)
+{
+    init(mode);
+}
+
+//------------------------------------------------------------------------------
+// Configuration
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set digits of the bar in MeterSegments mode
+ * \details
+ *      Only these digits are written, the other digits can be used for
+ *      other values. The default is all digits of the board. The default
+ *      range follows the number of levels, a range set with setRange() is
+ *      not changed. Ignored in MeterLEDs mode.
+ * \param pos Most right digit 0..7
+ * \param numDigits Number of digits, two levels per digit
+ */
+void LKM1638Meter::setWindow(uint8_t pos, uint8_t numDigits)
+{
+    uint8_t boardDigits = _board.getNumDigits();
+    bool defaultRange = (_minValue == 0) && (_maxValue == _numLevels);
+
+    if ((_mode != MeterSegments) || (pos >= boardDigits) || (numDigits == 0)) {
+        return;
+    }
+
+    _pos = pos;
+    _numDigits = ((pos + numDigits) > boardDigits) ? (uint8_t)(boardDigits - pos) : numDigits;
+    _numLevels = (uint8_t)(2 * _numDigits);
+    if (defaultRange) {
+        _maxValue = _numLevels;
+    }
+    _target = 0;
+    _barLevel = 0;
+    _peakLevel = 0;
+    _level = 0;
+    _peak = 0;
+    setRedThreshold(_redValue);
+}
+
+/*!
+ * \brief Set value range
+ * \details
+ *      The default range is 0..getNumLevels(), one level per value.
+ * \param minValue Value of level 0, all off
+ * \param maxValue Value of the highest level, all on
+ */
+void LKM1638Meter::setRange(long minValue, long maxValue)
+{
+    if (minValue < maxValue) {
+        _minValue = minValue;
+        _maxValue = maxValue;
+        setRedThreshold(_redValue);
+    }
+}
+
+/*!
+ * \brief Set lowest value of red LED's
+ * \details
+ *      LED's from the level of this value are red, lower LED's are green. A
+ *      value above the range turns all LED's green (default).
+ * \param value Value
+ */
+void LKM1638Meter::setRedThreshold(long value)
+{
+    _redValue = value;
+
+    if (value > _maxValue) {
+        _redLevel = (uint8_t)(_numLevels + 1);
+    } else {
+        _redLevel = toLevel(value);
+        if (_redLevel == 0) {
+            _redLevel = 1;
+        }
+    }
+    _displayed = false;
+}
+
+/*!
+ * \brief Set peak hold time
+ * \param holdMs Time in ms the highest level is displayed, 0 for no peak
+ *      (default)
+ */
+void LKM1638Meter::setPeakHold(uint16_t holdMs)
+{
+    _holdMs = holdMs;
+}
+
+/*!
+ * \brief Set decay time
+ * \details
+ *      The bar rises immediately and falls one level per decay time. After the
+ *      hold time, the peak falls with the same speed.
+ * \param levelMs Time in ms per level, 0 to fall at once (default)
+ */
+void LKM1638Meter::setDecay(uint16_t levelMs)
+{
+    _decayMs = levelMs;
+}
+
+//------------------------------------------------------------------------------
+// Update meter
+//------------------------------------------------------------------------------
+/*!
+ * \brief Set new sample
+ * \details
+ *      Values outside the range are displayed as the lowest or highest level.
+ * \param value Sample
+ */
+void LKM1638Meter::set(long value)
+{
+    _target = toLevel(value);
+    poll();
+}
+
+/*!
+ * \brief Update decay and peak hold
+ * \details
+ *      Call this function from loop() when no new samples are set.
+ * \retval true Meter written
+ * \retval false No change
+ */
+bool LKM1638Meter::poll()
+{
+    unsigned long now = millis();
+    unsigned long steps;
+    uint8_t level = 0;
+    uint8_t peak = 0;
+
+    // Bar rises at once and falls with the decay speed
+    if (_decayMs != 0) {
+        steps = (now - _barMs) / _decayMs;
+        if (steps < _barLevel) {
+            level = (uint8_t)(_barLevel - steps);
+        }
+    }
+    if (_target >= level) {
+        level = _target;
+        _barLevel = _target;
+        _barMs = now;
+    }
+
+    // Peak holds and falls with the decay speed
+    if (_holdMs != 0) {
+        if ((now - _peakMs) < _holdMs) {
+            peak = _peakLevel;
+        } else if (_decayMs != 0) {
+            steps = ((now - _peakMs - _holdMs) / _decayMs) + 1;
+            if (steps < _peakLevel) {
+                peak = (uint8_t)(_peakLevel - steps);
+            }
+        }
+        if (level >= peak) {
+            peak = level;
+            _peakLevel = level;
+            _peakMs = now;
+        }
+    }
+
+    if (_displayed && (level == _level) && (peak == _peak)) {
+        return false;
+    }
+
+    _level = level;
+    _peak = peak;
+    render();
+
+    return true;
+}
+
+/*!
+ * \brief Get displayed bar level
+ * \return Level 0..getNumLevels()
+ */
+uint8_t LKM1638Meter::getLevel()
+{
+    return _level;
+}
+
+/*!
+ * \brief Get displayed peak level
+ * \return Level 0..getNumLevels(), 0 without peak hold
+ */
+uint8_t LKM1638Meter::getPeak()
+{
+    return _peak;
+}
+
+/*!
+ * \brief Get number of levels
+ * \return Number of LED's for MeterLEDs, 2 * number of digits of the window for
+ *      MeterSegments
+ */
+uint8_t LKM1638Meter::getNumLevels()
+{
+    return _numLevels;
+}
+
+//------------------------------------------------------------------------------
+// Private functions
+//------------------------------------------------------------------------------
+/*!
+ * \brief Initialize meter
+ * \param mode MeterLEDs or MeterSegments
+ */
+void LKM1638Meter::init(MeterMode mode)
+{
+    _mode = mode;
+    _pos = 0;
+    _numDigits = _board.getNumDigits();
+    _numLevels = (mode == MeterSegments) ? (uint8_t)(2 * _numDigits) :
+                                           _board.getNumColorLEDs();
+    _minValue = 0;
+    _maxValue = _numLevels;
+    _holdMs = 0;
+    _decayMs = 0;
+    _target = 0;
+    _barLevel = 0;
+    _barMs = 0;
+    _peakLevel = 0;
+    _peakMs = 0;
+    _level = 0;
+    _peak = 0;
+    setRedThreshold(METER_NO_RED);
+}
+
+/*!
+ * \brief Convert value to level
+ * \param value Value
+ * \return Level 0..numLevels
+ */
+uint8_t LKM1638Meter::toLevel(long value)
+{
+    unsigned long span = (unsigned long)_maxValue - (unsigned long)_minValue;
+    unsigned long offset = (unsigned long)value - (unsigned long)_minValue;
+
+    if (value <= _minValue) {
+        return 0;
+    }
+    if (value >= _maxValue) {
+        return _numLevels;
+    }
+
+    // Prevent overflow of the multiplication for large ranges
+    while (span > 0x00FFFFFFUL) {
+        span >>= 1;
+        offset >>= 1;
+    }
+
+    return (uint8_t)((offset * _numLevels) / span);
+}
+
+/*!
+ * \brief Write bar and peak
+ * \details
+ *      Only the LED's or digits which changed are written.
+ */
+void LKM1638Meter::render()
+{
+    if (_mode == MeterSegments) {
+        uint8_t segments[LKM1638_MAX_DIGITS];
+
+        // segments[0] is the most right digit of the window
+        memset(segments, 0, sizeof(segments));
+        for (uint8_t level = 1; level <= _numLevels; level++) {
+            if ((level <= _level) || (level == _peak)) {
+                uint8_t pos = (uint8_t)(_numDigits - 1 - ((level - 1) / 2));
+
+                segments[pos] |= (level & 1) ? METER_SEGMENTS_LEFT : METER_SEGMENTS_RIGHT;
+            }
+        }
+        _board.setSegmentsDigits(_pos, segments, _numDigits);
+    } else {
+        uint8_t redLeds = 0;
+        uint8_t greenLeds = 0;
+
+        for (uint8_t level = 1; level <= _numLevels; level++) {
+            if ((level <= _level) || (level == _peak)) {
+                uint8_t led = (uint8_t)(1 << (_numLevels - level));
+
+                if (level >= _redLevel) {
+                    redLeds |= led;
+                } else {
+                    greenLeds |= led;
+                }
+            }
+        }
+        _board.setColorLEDs(redLeds, greenLeds);
+    }
+
+    _displayed = true;
+}
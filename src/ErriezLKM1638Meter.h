@@ -0,0 +1,104 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Meter.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_METER_H_
+#define ERRIEZ_LKM1638_METER_H_
+
+#include "ErriezLKM1638Platform.h"
+
+#include "ErriezLKM1638Board.h"
+
+/*!
+ * \brief Meter display
+ */
+typedef enum {
+    MeterLEDs = 0,      //!< Bar on the dual color LED's, one level per LED
+    MeterSegments = 1   //!< Bar on the digits, two levels per digit
+} MeterMode;
+
+/*!
+ * \brief LKM1638Meter class
+ * \details
+ *      Level meter from left to right with peak hold and decay. Every sample
+ *      is converted to a level first. The board is only written when the
+ *      displayed level or peak changed, and then only the LED's or digits
+ *      which changed.
+ */
+class LKM1638Meter
+{
+public:
+    // Constructor
+    explicit LKM1638Meter(LKM1638Board &board);
+    LKM1638Meter(LKM1638Board &board, MeterMode mode);
+
+    // Configuration
+    void setWindow(uint8_t pos, uint8_t numDigits);
+    void setRange(long minValue, long maxValue);
+    void setRedThreshold(long value);
+    void setPeakHold(uint16_t holdMs);
+    void setDecay(uint16_t levelMs);
+
+    // Update meter
+    void set(long value);
+    bool poll();
+    uint8_t getLevel();
+    uint8_t getPeak();
+    uint8_t getNumLevels();
+
+protected:
+    LKM1638Board &_board;       //!< Board
+    MeterMode _mode;            //!< LED's or digits
+    uint8_t _pos;               //!< Most right digit of the bar
+    uint8_t _numDigits;         //!< Number of digits of the bar
+    uint8_t _numLevels;         //!< Number of levels
+    long _minValue;             //!< Value of level 0
+    long _maxValue;             //!< Value of the highest level
+    long _redValue;             //!< Lowest value of red LED's
+    uint8_t _redLevel;          //!< Lowest red LED level
+    uint16_t _holdMs;           //!< Peak hold time, 0 disables the peak
+    uint16_t _decayMs;          //!< Time per level to fall, 0 falls at once
+    uint8_t _target;            //!< Level of the last sample
+    uint8_t _barLevel;          //!< Bar level when it started to fall
+    unsigned long _barMs;       //!< Time the bar started to fall
+    uint8_t _peakLevel;         //!< Held peak level
+    unsigned long _peakMs;      //!< Time of the held peak
+    uint8_t _level;             //!< Displayed bar level
+    uint8_t _peak;              //!< Displayed peak level, 0 is no peak
+    bool _displayed;            //!< Level and peak written to the board
+
+    void init(MeterMode mode);
+    uint8_t toLevel(long value);
+    void render();
+};
+
+#endif // ERRIEZ_LKM1638_METER_H_
@@ -0,0 +1,79 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Platform.cpp
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#include "ErriezLKM1638Platform.h"
+
+#if !LKM1638_ARDUINO
+
+#include <time.h>
+
+/*!
+ * \brief Get monotonic time in us since the first call
+ * \return Time in us, wraps like the Arduino function
+ */
+static uint64_t getTimeUs()
+{
+    static uint64_t startUs;
+    static bool started;
+    struct timespec now;
+    uint64_t us;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    us = ((uint64_t)now.tv_sec * 1000000UL) + ((uint64_t)now.tv_nsec / 1000UL);
+    if (!started) {
+        startUs = us;
+        started = true;
+    }
+
+    return us - startUs;
+}
+
+/*!
+ * \brief Milliseconds since the first call of millis() or micros()
+ * \return Time in ms
+ */
+unsigned long millis()
+{
+    return (unsigned long)(getTimeUs() / 1000UL);
+}
+
+/*!
+ * \brief Microseconds since the first call of millis() or micros()
+ * \return Time in us
+ */
+unsigned long micros()
+{
+    return (unsigned long)getTimeUs();
+}
+
+#endif // !LKM1638_ARDUINO
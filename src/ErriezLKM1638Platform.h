@@ -0,0 +1,93 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Erriez
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*!
+ * \file ErriezLKM1638Platform.h
+ * \brief JY-LKM1638 board v1.1 library for Arduino
+ * \details
+ *   Source:         https://github.com/Erriez/ErriezTM1638
+ *   Source:         https://github.com/Erriez/ErriezLKM1638
+ *   Documentation:  https://erriez.github.io/ErriezLKM1638
+ */
+
+#ifndef ERRIEZ_LKM1638_PLATFORM_H_
+#define ERRIEZ_LKM1638_PLATFORM_H_
+
+// LKM1638Board is derived from the TM1638 library by default. Build with
+// -DLKM1638_TM1638=0 to use LKM1638BusBoard without the TM1638 library, for
+// example on Linux without the Arduino core.
+#ifndef LKM1638_TM1638
+#define LKM1638_TM1638      1 //!< LKM1638Board derived from TM1638
+#endif
+
+#if defined(ARDUINO) || LKM1638_TM1638
+#define LKM1638_ARDUINO     1 //!< Arduino core available
+
+#include <Arduino.h>
+#else
+#define LKM1638_ARDUINO     0 //!< No Arduino core
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Radius of the print functions
+#define DEC                 10 //!< Decimal
+#define HEX                 16 //!< Hexadecimal
+#define OCT                 8  //!< Octal
+#define BIN                 2  //!< Binary
+
+// Flash strings are regular strings
+class __FlashStringHelper;
+#define F(s)                (reinterpret_cast<const __FlashStringHelper *>(s)) //!< Flash string
+
+// Time since the first call, see ErriezLKM1638Platform.cpp
+unsigned long millis();
+unsigned long micros();
+#endif
+
+// Program memory of the segment tables, flash strings and animations
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#elif defined(ARDUINO)
+#include <pgmspace.h>
+#else
+// Program memory is regular memory
+#include <string.h>
+
+#ifndef PROGMEM
+#define PROGMEM                                 //!< Program memory attribute
+#endif
+#ifndef pgm_read_byte
+#define pgm_read_byte(addr)   (*(const uint8_t *)(addr))  //!< Read Byte
+#endif
+#ifndef pgm_read_dword
+#define pgm_read_dword(addr)  (*(const uint32_t *)(addr)) //!< Read 32-bit
+#endif
+#ifndef strlen_P
+#define strlen_P              strlen //!< Length of a string in program memory
+#endif
+#endif
+
+#endif // ERRIEZ_LKM1638_PLATFORM_H_